@@ -252,6 +252,7 @@ public class VespaMetricSet {
         metrics.add(new Metric("content.proton.documentdb.index.memory_usage.used_bytes.average"));
         metrics.add(new Metric("content.proton.documentdb.index.memory_usage.dead_bytes.average"));
         metrics.add(new Metric("content.proton.documentdb.index.memory_usage.onhold_bytes.average"));
+        metrics.add(new Metric("content.proton.documentdb.index.fusion_throughput.last"));
 
         return metrics;
     }
@@ -10,6 +10,7 @@
 #include <vespa/document/serialization/vespadocumentdeserializer.h>
 #include <vespa/document/serialization/vespadocumentserializer.h>
 #include <vespa/vespalib/objects/nbostream.h>
+#include <vespa/vespalib/data/databuffer.h>
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/document/util/serializableexceptions.h>
 #include <vespa/document/util/bytebuffer.h>
@@ -44,6 +45,7 @@ struct DocumentTest : public CppUnit::TestFixture {
     void testAnnotationDeserialization();
     void testGetSerializedSize();
     void testDeserializeMultiple();
+    void testDeserializeFromBackingBuffer();
     void testSizeOf();
 
     CPPUNIT_TEST_SUITE(DocumentTest);
@@ -68,6 +70,7 @@ struct DocumentTest : public CppUnit::TestFixture {
     CPPUNIT_TEST(testAnnotationDeserialization);
     CPPUNIT_TEST(testGetSerializedSize);
     CPPUNIT_TEST(testDeserializeMultiple);
+    CPPUNIT_TEST(testDeserializeFromBackingBuffer);
     CPPUNIT_TEST(testSizeOf);
     CPPUNIT_TEST_SUITE_END();
 };
@@ -76,7 +79,7 @@ CPPUNIT_TEST_SUITE_REGISTRATION(DocumentTest);
 
 void DocumentTest::testSizeOf()
 {
-    CPPUNIT_ASSERT_EQUAL(136ul, sizeof(Document));
+    CPPUNIT_ASSERT_EQUAL(144ul, sizeof(Document));
     CPPUNIT_ASSERT_EQUAL(72ul, sizeof(StructFieldValue));
     CPPUNIT_ASSERT_EQUAL(24ul, sizeof(StructuredFieldValue));
     CPPUNIT_ASSERT_EQUAL(64ul, sizeof(SerializableArray));
@@ -1429,4 +1432,28 @@ DocumentTest::testDeserializeMultiple()
     CPPUNIT_ASSERT_EQUAL(correct, sv3);
 }
 
+void
+DocumentTest::testDeserializeFromBackingBuffer()
+{
+    TestDocRepo testDocRepo;
+    const DocumentTypeRepo& repo(testDocRepo.getTypeRepo());
+    Document doc(*repo.getDocumentType("testdoctype1"), DocumentId("doc:ns:testdoc"));
+    doc.set("headerval", 42);
+    doc.set("content", "a string that is referenced rather than copied");
+
+    nbostream stream;
+    doc.serialize(stream);
+    vespalib::DataBuffer buffer(stream.size());
+    buffer.writeBytes(stream.peek(), stream.size());
+
+    std::unique_ptr<Document> doc2(new Document(repo, buffer));
+    CPPUNIT_ASSERT_EQUAL(size_t(0), buffer.getDataLen());
+    CPPUNIT_ASSERT_EQUAL(doc, *doc2);
+
+    // Copies must not depend on the buffer owned by the original.
+    Document copy(*doc2);
+    doc2.reset();
+    CPPUNIT_ASSERT_EQUAL(doc, copy);
+}
+
 } // document
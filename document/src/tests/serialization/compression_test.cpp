@@ -3,6 +3,8 @@
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/vespalib/stllike/string.h>
 #include <vespa/document/util/compressor.h>
+#include <vespa/document/util/zstdcompressor.h>
+#include <vespa/vespalib/stllike/asciistream.h>
 #include <vespa/vespalib/data/databuffer.h>
 
 #include <vespa/log/log.h>
@@ -41,6 +43,66 @@ TEST("requireThatZStdCompressFine") {
     EXPECT_EQUAL(64u, compressed.getDataLen());
 }
 
+namespace {
+
+vespalib::string
+makeSample(uint32_t i) {
+    vespalib::asciistream os;
+    os << "{\"title\":\"Product number " << i << "\",\"category\":\"category " << (i % 17)
+       << "\",\"description\":\"This is the description of product " << i
+       << " which shares most of its structure with all the other products\",\"price\":" << (i * 7) % 1000 << "}";
+    return os.str();
+}
+
+ZStdDictionary::SP
+trainDictionary() {
+    std::vector<vespalib::string> samples;
+    for (uint32_t i(0); i < 2000; i++) {
+        samples.push_back(makeSample(i));
+    }
+    std::vector<ConstBufferRef> refs;
+    for (const vespalib::string & sample : samples) {
+        refs.emplace_back(sample.c_str(), sample.size());
+    }
+    return ZStdDictionary::train(refs, 4096);
+}
+
+}
+
+TEST("requireThatZStdDictionaryCompressSmallBuffersBetter") {
+    ZStdDictionary::SP dictionary = trainDictionary();
+    ASSERT_TRUE(dictionary);
+    EXPECT_NOT_EQUAL(0u, dictionary->getId());
+    EXPECT_EQUAL(dictionary.get(), ZStdDictionary::find(dictionary->getId()).get());
+
+    CompressionConfig cfg(CompressionConfig::Type::ZSTD, 9, 100);
+    vespalib::string sample = makeSample(4711);
+    ConstBufferRef ref(sample.c_str(), sample.size());
+    DataBuffer plain;
+    DataBuffer withDictionary;
+    compress(cfg, ref, plain, false);
+    EXPECT_EQUAL(CompressionConfig::Type::ZSTD, compress(cfg, dictionary.get(), ref, withDictionary, false));
+    EXPECT_LESS(withDictionary.getDataLen() * 2, plain.getDataLen());
+
+    DataBuffer decompressed;
+    decompress(CompressionConfig::Type::ZSTD, sample.size(), ConstBufferRef(withDictionary.getData(), withDictionary.getDataLen()), decompressed, false);
+    EXPECT_EQUAL(sample, vespalib::string(decompressed.getData(), decompressed.getDataLen()));
+}
+
+TEST("requireThatZStdDictionaryCanBeRecreatedFromContent") {
+    ZStdDictionary::SP dictionary = trainDictionary();
+    ASSERT_TRUE(dictionary);
+    uint32_t id = dictionary->getId();
+    vespalib::string content(dictionary->getContent().c_str(), dictionary->getContent().size());
+    EXPECT_EQUAL(dictionary.get(), ZStdDictionary::create(dictionary->getContent()).get());
+    dictionary.reset();
+    EXPECT_FALSE(ZStdDictionary::find(id));
+    dictionary = ZStdDictionary::create(ConstBufferRef(content.c_str(), content.size()));
+    ASSERT_TRUE(dictionary);
+    EXPECT_EQUAL(id, dictionary->getId());
+    EXPECT_FALSE(ZStdDictionary::create(ConstBufferRef("not a dictionary", 16)));
+}
+
 TEST_MAIN() {
     TEST_RUN_ALL();
 }
@@ -7,6 +7,8 @@
 #include <vespa/document/serialization/vespadocumentdeserializer.h>
 #include <vespa/document/serialization/vespadocumentserializer.h>
 #include <vespa/vespalib/objects/nbostream.h>
+#include <vespa/vespalib/data/databuffer.h>
+#include <vespa/vespalib/util/alloc.h>
 #include <vespa/document/util/serializableexceptions.h>
 #include <vespa/document/base/exceptions.h>
 #include <vespa/document/util/bytebuffer.h>
@@ -117,6 +119,23 @@ Document::Document(const DocumentTypeRepo& repo, vespalib::nbostream & is, const
     deserialize(repo, is);
 }
 
+Document::Document(const DocumentTypeRepo& repo, vespalib::DataBuffer& backingBuffer)
+    : StructuredFieldValue(*DataType::DOCUMENT),
+      _backingBuffer(),
+      _id(),
+      _fields(static_cast<const DocumentType &>(getType()).getFieldsType()),
+      _lastModified(0)
+{
+    if (backingBuffer.referencesExternalData()) {
+        vespalib::nbostream is(backingBuffer.getData(), backingBuffer.getDataLen());
+        deserialize(repo, is);
+    } else {
+        vespalib::nbostream_longlivedbuf is(backingBuffer.getData(), backingBuffer.getDataLen());
+        _backingBuffer = std::make_unique<vespalib::alloc::Alloc>(backingBuffer.stealBuffer());
+        deserialize(repo, is);
+    }
+}
+
 Document::Document(const DocumentTypeRepo& repo, ByteBuffer& buffer, bool includeContent, const DataType *anticipatedType)
     : StructuredFieldValue(anticipatedType ?  verifyDocumentType(anticipatedType) : *DataType::DOCUMENT),
       _id(),
@@ -152,6 +171,7 @@ Document::swap(Document & rhs)
 {
     StructuredFieldValue::swap(rhs);
     _fields.swap(rhs._fields);
+    _backingBuffer.swap(rhs._backingBuffer);
     _id.swap(rhs._id);
     std::swap(_lastModified, rhs._lastModified);
 }
@@ -166,6 +186,9 @@ Document& Document::operator=(const Document& doc)
     StructuredFieldValue::operator=(doc);
     _id = doc._id;
     _fields = doc._fields;
+    if (this != &doc) {
+        _backingBuffer.reset();
+    }
     _lastModified = doc._lastModified;
     return *this;
 }
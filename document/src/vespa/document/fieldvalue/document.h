@@ -19,11 +19,19 @@
 #include <vespa/document/base/documentid.h>
 #include <vespa/document/base/field.h>
 
+namespace vespalib {
+class DataBuffer;
+namespace alloc { class Alloc; }
+}
+
 namespace document {
 
 class Document : public StructuredFieldValue
 {
 private:
+    // Serialized document that the fields may reference instead of owning
+    // a copy. Declared first so that it outlives the fields.
+    std::unique_ptr<vespalib::alloc::Alloc> _backingBuffer;
     DocumentId _id;
     StructFieldValue _fields;
 
@@ -47,6 +55,14 @@ public:
     Document(const DocumentTypeRepo& repo,
              vespalib::nbostream& stream,
              const DataType *anticipatedType = 0);
+    /**
+       Constructor to deserialize from a buffer that the document takes over, leaving it empty.
+       The serialized structs and string payloads then reference the buffer instead of being copied,
+       and each field is still only decoded when accessed. A buffer referencing external data is
+       left untouched, and the document makes its own copies.
+    */
+    Document(const DocumentTypeRepo& repo,
+             vespalib::DataBuffer& backingBuffer);
     /**
        Constructor to deserialize only document and type from a buffer. Only relevant if includeContent is false.
     */
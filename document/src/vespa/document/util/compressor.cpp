@@ -29,7 +29,7 @@ compress(ICompressor & compressor, const CompressionConfig & compression, const
 }
 
 CompressionConfig::Type
-docompress(const CompressionConfig & compression, const ConstBufferRef & org, DataBuffer & dest)
+docompress(const CompressionConfig & compression, const ZStdDictionary * dictionary, const ConstBufferRef & org, DataBuffer & dest)
 {
     CompressionConfig::Type type(CompressionConfig::NONE);
     switch (compression.type) {
@@ -41,7 +41,7 @@ docompress(const CompressionConfig & compression, const ConstBufferRef & org, Da
         break;
     case CompressionConfig::ZSTD:
         {
-            ZStdCompressor zstd;
+            ZStdCompressor zstd(dictionary);
             type = compress(zstd, compression, org, dest);
         }
         break;
@@ -54,10 +54,17 @@ docompress(const CompressionConfig & compression, const ConstBufferRef & org, Da
 
 CompressionConfig::Type
 compress(const CompressionConfig & compression, const ConstBufferRef & org, DataBuffer & dest, bool allowSwap)
+{
+    return compress(compression, nullptr, org, dest, allowSwap);
+}
+
+CompressionConfig::Type
+compress(const CompressionConfig & compression, const ZStdDictionary * dictionary,
+         const ConstBufferRef & org, DataBuffer & dest, bool allowSwap)
 {
     CompressionConfig::Type type(CompressionConfig::NONE);
     if (org.size() >= compression.minSize) {
-        type = docompress(compression, org, dest);
+        type = docompress(compression, dictionary, org, dest);
     }
     if (type == CompressionConfig::NONE) {
         if (allowSwap) {
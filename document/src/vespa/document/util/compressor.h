@@ -8,6 +8,8 @@ namespace vespalib { class DataBuffer; }
 
 namespace document {
 
+class ZStdDictionary;
+
 class ICompressor
 {
 public:
@@ -30,6 +32,13 @@ namespace compression {
  */
 CompressionConfig::Type compress(const CompressionConfig & compression, const vespalib::ConstBufferRef & org, vespalib::DataBuffer & dest, bool allowSwap);
 
+/**
+ * Same as above, but zstd compression will use the given dictionary if it is not null.
+ * Decompression finds the dictionary by itself, as long as it is kept alive.
+ */
+CompressionConfig::Type compress(const CompressionConfig & compression, const ZStdDictionary * dictionary,
+                                 const vespalib::ConstBufferRef & org, vespalib::DataBuffer & dest, bool allowSwap);
+
 /**
  * Will try to decompress a buffer according to the config.
  * be met it will return NONE and dest will get the input buffer.
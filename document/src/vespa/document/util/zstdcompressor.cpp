@@ -3,11 +3,16 @@
 #include "zstdcompressor.h"
 #include <vespa/vespalib/util/alloc.h>
 #include <vespa/vespalib/util/sync.h>
+#include <vespa/vespalib/util/stringfmt.h>
 #include <zstd.h>
-#include <vector>
+#include <zdict.h>
+#include <algorithm>
+#include <map>
+#include <stdexcept>
 #include <cassert>
 
 using vespalib::alloc::Alloc;
+using vespalib::ConstBufferRef;
 
 namespace document {
 
@@ -33,6 +38,137 @@ private:
 thread_local std::unique_ptr<CompressContext>  _tlCompressState;
 thread_local std::unique_ptr<DecompressContext> _tlDecompressState;
 
+ZSTD_CCtx * getCompressContext() {
+    if ( ! _tlCompressState) {
+        _tlCompressState = std::make_unique<CompressContext>();
+    }
+    return _tlCompressState->get();
+}
+
+ZSTD_DCtx * getDecompressContext() {
+    if ( ! _tlDecompressState) {
+        _tlDecompressState = std::make_unique<DecompressContext>();
+    }
+    return _tlDecompressState->get();
+}
+
+class DictionaryRegistry {
+public:
+    ZStdDictionary::SP find(uint32_t id) const {
+        std::lock_guard<std::mutex> guard(_lock);
+        auto found = _dictionaries.find(id);
+        return (found != _dictionaries.end()) ? found->second.lock() : ZStdDictionary::SP();
+    }
+    ZStdDictionary::SP add(ZStdDictionary::SP dictionary) {
+        std::lock_guard<std::mutex> guard(_lock);
+        std::weak_ptr<const ZStdDictionary> & entry = _dictionaries[dictionary->getId()];
+        ZStdDictionary::SP existing = entry.lock();
+        if (existing) {
+            return existing;
+        }
+        entry = dictionary;
+        return dictionary;
+    }
+    void remove(uint32_t id) {
+        std::lock_guard<std::mutex> guard(_lock);
+        auto found = _dictionaries.find(id);
+        if ((found != _dictionaries.end()) && found->second.expired()) {
+            _dictionaries.erase(found);
+        }
+    }
+private:
+    mutable std::mutex _lock;
+    std::map<uint32_t, std::weak_ptr<const ZStdDictionary>> _dictionaries;
+};
+
+DictionaryRegistry _registry;
+
+}
+
+ZStdDictionary::ZStdDictionary(const ConstBufferRef & content, uint32_t id)
+    : _content(content.c_str(), content.c_str() + content.size()),
+      _id(id),
+      _ddict(ZSTD_createDDict(&_content[0], _content.size())),
+      _lock(),
+      _cdicts(ZSTD_maxCLevel() + 1, nullptr)
+{
+    assert(_ddict != nullptr);
+}
+
+ZStdDictionary::~ZStdDictionary()
+{
+    _registry.remove(_id);
+    for (ZSTD_CDict * cdict : _cdicts) {
+        ZSTD_freeCDict(cdict);
+    }
+    ZSTD_freeDDict(_ddict);
+}
+
+ZStdDictionary::SP
+ZStdDictionary::create(const ConstBufferRef & content)
+{
+    uint32_t id = (content.size() > 0) ? ZDICT_getDictID(content.c_str(), content.size()) : 0;
+    if (id == 0) {
+        return SP();
+    }
+    return _registry.add(SP(new ZStdDictionary(content, id)));
+}
+
+ZStdDictionary::SP
+ZStdDictionary::train(const std::vector<ConstBufferRef> & samples, size_t maxSize)
+{
+    std::vector<char> samplesBuffer;
+    std::vector<size_t> sampleSizes;
+    sampleSizes.reserve(samples.size());
+    for (const ConstBufferRef & sample : samples) {
+        samplesBuffer.insert(samplesBuffer.end(), sample.c_str(), sample.c_str() + sample.size());
+        sampleSizes.push_back(sample.size());
+    }
+    if (samplesBuffer.empty()) {
+        return SP();
+    }
+    std::vector<char> content(maxSize);
+    size_t sz = ZDICT_trainFromBuffer(&content[0], content.size(), &samplesBuffer[0], &sampleSizes[0], sampleSizes.size());
+    if (ZDICT_isError(sz)) {
+        return SP();
+    }
+    return create(ConstBufferRef(&content[0], sz));
+}
+
+ZStdDictionary::SP
+ZStdDictionary::find(uint32_t id)
+{
+    return _registry.find(id);
+}
+
+ZSTD_CDict *
+ZStdDictionary::getCDict(int level) const
+{
+    level = std::max(1, std::min(level, ZSTD_maxCLevel()));
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_cdicts[level] == nullptr) {
+        _cdicts[level] = ZSTD_createCDict(&_content[0], _content.size(), level);
+    }
+    return _cdicts[level];
+}
+
+bool
+ZStdDictionary::compress(int level, const void * input, size_t inputLen, void * output, size_t & outputLen) const
+{
+    size_t maxOutputLen = ZSTD_compressBound(inputLen);
+    size_t sz = ZSTD_compress_usingCDict(getCompressContext(), output, maxOutputLen, input, inputLen, getCDict(level));
+    assert( ! ZSTD_isError(sz) );
+    outputLen = sz;
+    return ! ZSTD_isError(sz);
+}
+
+bool
+ZStdDictionary::decompress(const void * input, size_t inputLen, void * output, size_t & outputLen) const
+{
+    size_t sz = ZSTD_decompress_usingDDict(getDecompressContext(), output, outputLen, input, inputLen, _ddict);
+    assert( ! ZSTD_isError(sz) );
+    outputLen = sz;
+    return ! ZSTD_isError(sz);
 }
 
 size_t ZStdCompressor::adjustProcessLen(uint16_t, size_t len)   const { return ZSTD_compressBound(len); }
@@ -40,11 +176,11 @@ size_t ZStdCompressor::adjustProcessLen(uint16_t, size_t len)   const { return Z
 bool
 ZStdCompressor::process(const CompressionConfig& config, const void * inputV, size_t inputLen, void * outputV, size_t & outputLenV)
 {
-    size_t maxOutputLen = ZSTD_compressBound(inputLen);
-    if ( ! _tlCompressState) {
-        _tlCompressState = std::make_unique<CompressContext>();
+    if (_dictionary != nullptr) {
+        return _dictionary->compress(config.compressionLevel, inputV, inputLen, outputV, outputLenV);
     }
-    size_t sz = ZSTD_compressCCtx(_tlCompressState->get(), outputV, maxOutputLen, inputV, inputLen, config.compressionLevel);
+    size_t maxOutputLen = ZSTD_compressBound(inputLen);
+    size_t sz = ZSTD_compressCCtx(getCompressContext(), outputV, maxOutputLen, inputV, inputLen, config.compressionLevel);
     assert( ! ZSTD_isError(sz) );
     outputLenV = sz;
     return ! ZSTD_isError(sz);
@@ -53,10 +189,15 @@ ZStdCompressor::process(const CompressionConfig& config, const void * inputV, si
 bool
 ZStdCompressor::unprocess(const void * inputV, size_t inputLen, void * outputV, size_t & outputLenV)
 {
-    if ( ! _tlDecompressState) {
-        _tlDecompressState = std::make_unique<DecompressContext>();
+    uint32_t dictionaryId = ZSTD_getDictID_fromFrame(inputV, inputLen);
+    if (dictionaryId != 0) {
+        ZStdDictionary::SP dictionary = ZStdDictionary::find(dictionaryId);
+        if ( ! dictionary) {
+            throw std::runtime_error(vespalib::make_string("No zstd dictionary with id %u available for decompression", dictionaryId));
+        }
+        return dictionary->decompress(inputV, inputLen, outputV, outputLenV);
     }
-    size_t sz = ZSTD_decompressDCtx(_tlDecompressState->get(), outputV, outputLenV, inputV, inputLen);
+    size_t sz = ZSTD_decompressDCtx(getDecompressContext(), outputV, outputLenV, inputV, inputLen);
     assert( ! ZSTD_isError(sz) );
     outputLenV = sz;
     return ! ZSTD_isError(sz);
@@ -2,15 +2,71 @@
 #pragma once
 
 #include "compressor.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
 
 namespace document {
 
+/**
+ * A zstd dictionary trained from samples of many small and similar buffers,
+ * like the documents of a single document type. Each compressed frame records
+ * the id of the dictionary it was compressed with. All live dictionaries are
+ * registered by id, so decompression does not need to be told which one to use.
+ * The dictionary must be kept alive as long as data compressed with it is read.
+ */
+class ZStdDictionary
+{
+public:
+    using SP = std::shared_ptr<const ZStdDictionary>;
+    ZStdDictionary(const ZStdDictionary &) = delete;
+    ZStdDictionary & operator = (const ZStdDictionary &) = delete;
+    ~ZStdDictionary();
+
+    /**
+     * Create a dictionary from serialized content, as returned by getContent().
+     * Returns an empty pointer if the content is not a valid zstd dictionary.
+     */
+    static SP create(const vespalib::ConstBufferRef & content);
+    /**
+     * Train a dictionary of at most maxSize bytes from the given samples.
+     * Returns an empty pointer if training failed, e.g. due to too few samples.
+     */
+    static SP train(const std::vector<vespalib::ConstBufferRef> & samples, size_t maxSize);
+    /**
+     * Find a live dictionary by id. Returns an empty pointer if there is none.
+     */
+    static SP find(uint32_t id);
+
+    uint32_t getId() const { return _id; }
+    vespalib::ConstBufferRef getContent() const { return vespalib::ConstBufferRef(&_content[0], _content.size()); }
+
+    bool compress(int level, const void * input, size_t inputLen, void * output, size_t & outputLen) const;
+    bool decompress(const void * input, size_t inputLen, void * output, size_t & outputLen) const;
+private:
+    ZStdDictionary(const vespalib::ConstBufferRef & content, uint32_t id);
+    ZSTD_CDict_s * getCDict(int level) const;
+
+    std::vector<char>                    _content;
+    uint32_t                             _id;
+    ZSTD_DDict_s                       * _ddict;
+    mutable std::mutex                   _lock;
+    mutable std::vector<ZSTD_CDict_s *>  _cdicts;
+};
+
 class ZStdCompressor : public ICompressor
 {
 public:
+    ZStdCompressor() : _dictionary(nullptr) { }
+    ZStdCompressor(const ZStdDictionary * dictionary) : _dictionary(dictionary) { }
     bool process(const CompressionConfig& config, const void * input, size_t inputLen, void * output, size_t & outputLen) override;
     bool unprocess(const void * input, size_t inputLen, void * output, size_t & outputLen) override;
     size_t adjustProcessLen(uint16_t options, size_t len)   const override;
+private:
+    const ZStdDictionary * _dictionary;
 };
 
 }
@@ -2,6 +2,7 @@
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/eval/eval/gbdt.h>
 #include <vespa/eval/eval/vm_forest.h>
+#include <vespa/eval/eval/quick_scorer.h>
 #include <vespa/eval/eval/llvm/deinline_forest.h>
 #include <vespa/eval/eval/llvm/compiled_function.h>
 #include <vespa/eval/eval/function.h>
@@ -76,6 +77,22 @@ struct DeinlineForestStrategy : CompileStrategy {
 };
 DeinlineForestStrategy deinline_forest;
 
+struct QuickScorerStrategy : CompileStrategy {
+    const char *name() const override {
+        return "quick-scorer";
+    }
+    const char *code_name() const override {
+        return "QuickScorer::optimize_chain";
+    }
+    CompiledFunction compile(const Function &function) const override {
+        return CompiledFunction(function, PassParams::ARRAY, QuickScorer::optimize_chain);
+    }
+    CompiledFunction compile_lazy(const Function &function) const override {
+        return CompiledFunction(function, PassParams::LAZY, QuickScorer::optimize_chain);
+    }
+};
+QuickScorerStrategy quick_scorer;
+
 //-----------------------------------------------------------------------------
 
 struct Option {
@@ -260,6 +277,18 @@ void dump_plan(const ForestParams &params, const Plan &plan) {
 
 //-----------------------------------------------------------------------------
 
+TEST("measure quick scorer against other forest evaluation strategies") {
+    std::vector<Option> options({{0, none}, {1, vm_forest}, {2, deinline_forest}, {3, quick_scorer}});
+    for (size_t tree_size: std::vector<size_t>({8, 32})) {
+        ForestParams params(1234u, 100, tree_size);
+        fprintf(stderr, "forest with 1000 trees of size %zu:\n", tree_size);
+        std::vector<Option> order = find_order(params, options, 1000);
+        fprintf(stderr, "  fastest: %s\n", order[0].name());
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 TEST("find optimization plans") {
     std::vector<size_t> less_percent_values({90, 100});
     std::vector<size_t> tree_size_values(
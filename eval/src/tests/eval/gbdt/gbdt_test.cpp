@@ -2,6 +2,7 @@
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/eval/eval/gbdt.h>
 #include <vespa/eval/eval/vm_forest.h>
+#include <vespa/eval/eval/quick_scorer.h>
 #include <vespa/eval/eval/function.h>
 #include <vespa/eval/eval/llvm/deinline_forest.h>
 #include <vespa/eval/eval/llvm/compiled_function.h>
@@ -284,6 +285,42 @@ TEST("require that models with too large sets are rejected by general vm optimiz
 
 //-----------------------------------------------------------------------------
 
+TEST("require that quick scorer optimizer works") {
+    Function function = Function::parse("if((a<1),1.0,if((b<1),if((c<1),2.0,3.0),4.0))+"
+                                        "if((d<1),10.0,if((e<1),if((f<1),20.0,30.0),40.0))+"
+                                        "if((a<2),100.0,if((a<3),200.0,300.0))");
+    CompiledFunction compiled_function(function, PassParams::ARRAY, QuickScorer::optimize_chain);
+    ASSERT_EQUAL(1u, compiled_function.get_forests().size());
+    EXPECT_TRUE(dynamic_cast<QuickScorer*>(compiled_function.get_forests()[0].get()) != nullptr);
+    auto f = compiled_function.get_function();
+    EXPECT_EQUAL(111.0, f(&std::vector<double>({0.5, 0.0, 0.0, 0.5, 0.0, 0.0})[0]));
+    EXPECT_EQUAL(222.0, f(&std::vector<double>({2.5, 0.5, 0.5, 1.5, 0.5, 0.5})[0]));
+    EXPECT_EQUAL(333.0, f(&std::vector<double>({3.5, 0.5, 1.5, 1.5, 0.5, 1.5})[0]));
+    EXPECT_EQUAL(144.0, f(&std::vector<double>({1.5, 1.5, 0.0, 1.5, 1.5, 0.0})[0]));
+    EXPECT_EQUAL(344.0, f(&std::vector<double>({std::numeric_limits<double>::quiet_NaN(), 1.5, 0.0, 1.5, 1.5, 0.0})[0]));
+}
+
+TEST("require that models with in checks or large trees are rejected by quick scorer optimizer") {
+    Function function = Function::parse(Model().less_percent(100).make_forest(300, 64));
+    auto trees = extract_trees(function.root());
+    ForestStats stats(trees);
+    EXPECT_TRUE(Optimize::apply_chain(QuickScorer::optimize_chain, stats, trees).valid());
+    stats.total_in_checks = 1;
+    EXPECT_TRUE(!Optimize::apply_chain(QuickScorer::optimize_chain, stats, trees).valid());
+    Function large_function = Function::parse(Model().less_percent(100).make_forest(300, 65));
+    auto large_trees = extract_trees(large_function.root());
+    EXPECT_TRUE(!Optimize::apply_chain(QuickScorer::optimize_chain, ForestStats(large_trees), large_trees).valid());
+}
+
+TEST("require that quick scorer is selected for large forests of small trees") {
+    Function function = Function::parse(Model().less_percent(100).make_forest(1000, 32));
+    CompiledFunction compiled_function(function, PassParams::ARRAY);
+    ASSERT_EQUAL(1u, compiled_function.get_forests().size());
+    EXPECT_TRUE(dynamic_cast<QuickScorer*>(compiled_function.get_forests()[0].get()) != nullptr);
+}
+
+//-----------------------------------------------------------------------------
+
 double eval_compiled(const CompiledFunction &cfun, std::vector<double> &params) {
     ASSERT_EQUAL(params.size(), cfun.num_params());
     if (cfun.pass_params() == PassParams::ARRAY) {
@@ -305,6 +342,7 @@ TEST("require that forests evaluate to approximately the same for all evaluation
                     CompiledFunction none(function, pass_params, Optimize::none);
                     CompiledFunction deinline(function, pass_params, DeinlineForest::optimize_chain);
                     CompiledFunction vm_forest(function, pass_params, VMForest::optimize_chain);
+                    CompiledFunction quick_scorer(function, pass_params, QuickScorer::optimize_chain);
                     EXPECT_EQUAL(0u, none.get_forests().size());
                     ASSERT_EQUAL(1u, deinline.get_forests().size());
                     EXPECT_TRUE(dynamic_cast<DeinlineForest*>(deinline.get_forests()[0].get()) != nullptr);
@@ -315,7 +353,47 @@ TEST("require that forests evaluate to approximately the same for all evaluation
                     EXPECT_APPROX(expected, eval_compiled(none, inputs), 1e-6);
                     EXPECT_APPROX(expected, eval_compiled(deinline, inputs), 1e-6);
                     EXPECT_APPROX(expected, eval_compiled(vm_forest, inputs), 1e-6);
+                    if (less_percent == 100) {
+                        ASSERT_EQUAL(1u, quick_scorer.get_forests().size());
+                        EXPECT_TRUE(dynamic_cast<QuickScorer*>(quick_scorer.get_forests()[0].get()) != nullptr);
+                        EXPECT_APPROX(expected, eval_compiled(quick_scorer, inputs), 1e-6);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST("require that forests can be evaluated for batches of documents") {
+    for (const auto &chain: {Optimize::none, VMForest::optimize_chain}) {
+        for (size_t less_percent: std::vector<size_t>({100, 80})) {
+            Function function = Function::parse(Model().less_percent(less_percent).make_forest(30, 20));
+            CompiledFunction compiled_function(function, PassParams::ARRAY, chain);
+            if (chain.empty()) {
+                EXPECT_EQUAL(0u, compiled_function.get_forests().size());
+            } else {
+                ASSERT_EQUAL(1u, compiled_function.get_forests().size());
+                EXPECT_TRUE(dynamic_cast<VMForest*>(compiled_function.get_forests()[0].get()) != nullptr);
+            }
+            size_t num_docs = 37;
+            std::vector<std::vector<double>> columns(function.num_params(), std::vector<double>(num_docs));
+            for (size_t p = 0; p < columns.size(); ++p) {
+                for (size_t d = 0; d < num_docs; ++d) {
+                    columns[p][d] = double((p * 7 + d * 13) % 100) / 100.0;
+                }
+            }
+            std::vector<const double *> params;
+            for (const auto &column: columns) {
+                params.push_back(&column[0]);
+            }
+            std::vector<double> result(num_docs, 0.0);
+            compiled_function.eval_batch(&params[0], num_docs, &result[0]);
+            for (size_t d = 0; d < num_docs; ++d) {
+                std::vector<double> inputs;
+                for (const auto &column: columns) {
+                    inputs.push_back(column[d]);
                 }
+                EXPECT_EQUAL(eval_compiled(compiled_function, inputs), result[d]);
             }
         }
     }
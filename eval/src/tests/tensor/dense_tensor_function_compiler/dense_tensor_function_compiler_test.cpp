@@ -3,6 +3,7 @@
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/eval/tensor/dense/dense_dot_product_function.h>
 #include <vespa/eval/tensor/dense/dense_tensor_function_compiler.h>
+#include <vespa/eval/tensor/dense/dense_xw_product_function.h>
 
 using namespace vespalib::eval;
 using namespace vespalib::eval::operation;
@@ -62,4 +63,63 @@ TEST("require that dot product with incompatible dimensions is NOT compiled")
     TEST_DO(assertNotCompiledDotProduct("tensor(x[5],y[7])", "tensor(x[5],y[7])"));
 }
 
+TensorFunction::UP
+compileXWProduct(const vespalib::string &lhsType,
+                 const vespalib::string &rhsType,
+                 const vespalib::string &dimension)
+{
+    Node_UP reduceNode = reduce(apply(Mul(),
+                                      inject(ValueType::from_spec(lhsType), 1),
+                                      inject(ValueType::from_spec(rhsType), 3)),
+                                Add(), {dimension});
+    return DenseTensorFunctionCompiler::compile(std::move(reduceNode));
+}
+
+void
+assertCompiledXWProduct(const vespalib::string &lhsType,
+                        const vespalib::string &rhsType,
+                        const vespalib::string &dimension,
+                        size_t vectorId, size_t matrixId,
+                        size_t vectorSize, size_t resultSize,
+                        bool commonDimensionInnermost)
+{
+    TensorFunction::UP func = compileXWProduct(lhsType, rhsType, dimension);
+    const DenseXWProductFunction *xwProduct = as<DenseXWProductFunction>(*func);
+    ASSERT_TRUE(xwProduct);
+    EXPECT_EQUAL(vectorId, xwProduct->vectorId());
+    EXPECT_EQUAL(matrixId, xwProduct->matrixId());
+    EXPECT_EQUAL(vectorSize, xwProduct->vectorSize());
+    EXPECT_EQUAL(resultSize, xwProduct->resultSize());
+    EXPECT_EQUAL(commonDimensionInnermost, xwProduct->commonDimensionInnermost());
+}
+
+void
+assertNotCompiledXWProduct(const vespalib::string &lhsType,
+                           const vespalib::string &rhsType,
+                           const vespalib::string &dimension)
+{
+    TensorFunction::UP func = compileXWProduct(lhsType, rhsType, dimension);
+    const Reduce *reduce = as<Reduce>(*func);
+    EXPECT_TRUE(reduce);
+}
+
+TEST("require that xw product with compatible dimensions is compiled")
+{
+    TEST_DO(assertCompiledXWProduct("tensor(x[3])", "tensor(x[3],y[5])", "x", 1, 3, 3, 5, false));
+    TEST_DO(assertCompiledXWProduct("tensor(x[3],y[5])", "tensor(x[3])", "x", 3, 1, 3, 5, false));
+    TEST_DO(assertCompiledXWProduct("tensor(y[5])", "tensor(x[3],y[5])", "y", 1, 3, 5, 3, true));
+    TEST_DO(assertCompiledXWProduct("tensor(x[3],y[5])", "tensor(y[5])", "y", 3, 1, 5, 3, true));
+}
+
+TEST("require that xw product with incompatible dimensions is NOT compiled")
+{
+    TEST_DO(assertNotCompiledXWProduct("tensor(x[3])", "tensor(x[3],y[5])", "y"));
+    TEST_DO(assertNotCompiledXWProduct("tensor(x[3])", "tensor(x[4],y[5])", "x"));
+    TEST_DO(assertNotCompiledXWProduct("tensor(x[])",  "tensor(x[3],y[5])", "x"));
+    TEST_DO(assertNotCompiledXWProduct("tensor(x[3])", "tensor(x[3],y[])",  "x"));
+    TEST_DO(assertNotCompiledXWProduct("tensor(x[3])", "tensor(x[3],y{})",  "x"));
+    TEST_DO(assertNotCompiledXWProduct("tensor(x[3],y[5])", "tensor(x[3],y[5])", "x"));
+    TEST_DO(assertNotCompiledXWProduct("tensor(x[3])", "tensor(x[3],y[5],z[7])", "x"));
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
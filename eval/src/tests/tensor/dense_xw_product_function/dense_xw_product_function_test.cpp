@@ -0,0 +1,119 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/vespalib/testkit/test_kit.h>
+#include <vespa/eval/eval/tensor_function.h>
+#include <vespa/eval/eval/tensor_spec.h>
+#include <vespa/eval/eval/value.h>
+#include <vespa/eval/tensor/default_tensor_engine.h>
+#include <vespa/eval/tensor/dense/dense_tensor_function_compiler.h>
+#include <vespa/eval/tensor/dense/dense_xw_product_function.h>
+#include <vespa/vespalib/util/stash.h>
+#include <vespa/vespalib/util/stringfmt.h>
+
+using namespace vespalib;
+using namespace vespalib::eval;
+using namespace vespalib::eval::operation;
+using namespace vespalib::eval::tensor_function;
+using namespace vespalib::tensor;
+
+const TensorEngine &engine = DefaultTensorEngine::ref();
+
+TensorSpec
+makeVector(const vespalib::string &dim, size_t size)
+{
+    TensorSpec spec(make_string("tensor(%s[%zu])", dim.c_str(), size));
+    for (size_t i = 0; i < size; ++i) {
+        spec.add({{dim, i}}, 1.0 + i);
+    }
+    return spec;
+}
+
+TensorSpec
+makeMatrix(const vespalib::string &dim1, size_t size1,
+           const vespalib::string &dim2, size_t size2)
+{
+    TensorSpec spec(make_string("tensor(%s[%zu],%s[%zu])",
+                                dim1.c_str(), size1, dim2.c_str(), size2));
+    for (size_t i = 0; i < size1; ++i) {
+        for (size_t j = 0; j < size2; ++j) {
+            spec.add({{dim1, i}, {dim2, j}}, (i * 3.0) - j);
+        }
+    }
+    return spec;
+}
+
+class FunctionInput : public TensorFunction::Input
+{
+private:
+    Stash _stash;
+    std::vector<const Value *> _tensors;
+
+public:
+    FunctionInput(const TensorSpec &lhs, const TensorSpec &rhs)
+        : _stash(),
+          _tensors()
+    {
+        _tensors.push_back(&_stash.create<TensorValue>(engine.create(lhs)));
+        _tensors.push_back(&_stash.create<TensorValue>(engine.create(rhs)));
+    }
+    const Value &get_tensor(size_t id) const override { return *_tensors[id]; }
+    const UnaryOperation &get_map_operation(size_t) const override { abort(); }
+    ValueType type(size_t id) const { return _tensors[id]->type(); }
+};
+
+Node_UP
+makeXWProduct(const FunctionInput &input, const vespalib::string &dim)
+{
+    return reduce(apply(Mul(), inject(input.type(0), 0), inject(input.type(1), 1)), Add(), {dim});
+}
+
+TensorSpec
+evalToSpec(const TensorFunction &function, const FunctionInput &input)
+{
+    Stash stash;
+    const Value &result = function.eval(input, stash);
+    ASSERT_TRUE(result.is_tensor());
+    return engine.to_spec(*result.as_tensor());
+}
+
+void
+verifyXWProduct(const TensorSpec &lhs, const TensorSpec &rhs,
+                const vespalib::string &dim, bool commonDimensionInnermost)
+{
+    FunctionInput input(lhs, rhs);
+    Node_UP expr = makeXWProduct(input, dim);
+    TensorSpec expect = evalToSpec(*expr, input);
+    TensorFunction::UP function = DenseTensorFunctionCompiler::compile(makeXWProduct(input, dim));
+    const DenseXWProductFunction *xwProduct = dynamic_cast<const DenseXWProductFunction *>(function.get());
+    ASSERT_TRUE(xwProduct != nullptr);
+    EXPECT_EQUAL(commonDimensionInnermost, xwProduct->commonDimensionInnermost());
+    EXPECT_EQUAL(expect, evalToSpec(*function, input));
+}
+
+TEST("require that xw product with common outer dimension is correct")
+{
+    TEST_DO(verifyXWProduct(makeVector("x", 3), makeMatrix("x", 3, "y", 5), "x", false));
+    TEST_DO(verifyXWProduct(makeMatrix("x", 3, "y", 5), makeVector("x", 3), "x", false));
+    TEST_DO(verifyXWProduct(makeVector("x", 1), makeMatrix("x", 1, "y", 1), "x", false));
+}
+
+TEST("require that xw product with common inner dimension is correct")
+{
+    TEST_DO(verifyXWProduct(makeVector("y", 5), makeMatrix("x", 3, "y", 5), "y", true));
+    TEST_DO(verifyXWProduct(makeMatrix("x", 3, "y", 5), makeVector("y", 5), "y", true));
+    TEST_DO(verifyXWProduct(makeVector("y", 17), makeMatrix("x", 2, "y", 17), "y", true));
+}
+
+TEST("require that join of tensors with same type is correct")
+{
+    TensorSpec lhs = makeMatrix("x", 3, "y", 5);
+    FunctionInput input(lhs, lhs);
+    Node_UP expr = apply(Mul(), inject(input.type(0), 0), inject(input.type(1), 1));
+    TensorSpec expect(lhs.type());
+    for (const auto &cell : lhs.cells()) {
+        expect.add(cell.first, cell.second * cell.second);
+    }
+    EXPECT_EQUAL(expect, evalToSpec(*expr, input));
+}
+
+TEST_MAIN() { TEST_RUN_ALL(); }
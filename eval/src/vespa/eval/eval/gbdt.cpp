@@ -2,6 +2,7 @@
 
 #include "gbdt.h"
 #include "vm_forest.h"
+#include "quick_scorer.h"
 #include "node_traverser.h"
 #include <vespa/eval/eval/basic_nodes.h>
 #include <vespa/eval/eval/call_nodes.h>
@@ -142,6 +143,12 @@ Optimize::select_best(const ForestStats &stats,
                       const std::vector<const nodes::Node *> &trees)
 {
     double path_len = stats.total_average_path_length;
+    if ((stats.num_trees >= 256) && (stats.tree_sizes.back().size <= QuickScorer::MAX_LEAVES)) {
+        Result result = apply_chain(QuickScorer::optimize_chain, stats, trees);
+        if (result.valid()) {
+            return result;
+        }
+    }
     if ((stats.tree_sizes.back().size > 12) && (path_len > 2500.0)) {
         return apply_chain(VMForest::optimize_chain, stats, trees);
     }
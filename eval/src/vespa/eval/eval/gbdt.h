@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <memory>
+#include <cstddef>
 
 namespace vespalib {
 namespace eval {
@@ -80,6 +81,9 @@ bool contains_gbdt(const nodes::Node &node, size_t limit);
 struct Forest {
     using UP = std::unique_ptr<Forest>;
     using eval_function = double (*)(const Forest *self, const double *args);
+    // evaluate for multiple documents; args[param][doc], result[doc]
+    using batch_eval_function = void (*)(const Forest *self, const double * const *args,
+                                         size_t num_docs, double *result);
     virtual ~Forest() {}
 };
 
@@ -93,10 +97,12 @@ struct Optimize {
     struct Result {
         Forest::UP forest;
         Forest::eval_function eval;
-        Result() : forest(nullptr), eval(nullptr) {}
-        Result(Forest::UP &&forest_in, Forest::eval_function eval_in)
-            : forest(std::move(forest_in)), eval(eval_in) {}
-        Result(Result &&rhs) : forest(std::move(rhs.forest)), eval(rhs.eval) {}
+        Forest::batch_eval_function batch_eval;
+        Result() : forest(nullptr), eval(nullptr), batch_eval(nullptr) {}
+        Result(Forest::UP &&forest_in, Forest::eval_function eval_in,
+               Forest::batch_eval_function batch_eval_in = nullptr)
+            : forest(std::move(forest_in)), eval(eval_in), batch_eval(batch_eval_in) {}
+        Result(Result &&rhs) : forest(std::move(rhs.forest)), eval(rhs.eval), batch_eval(rhs.batch_eval) {}
         bool valid() const { return (forest.get() != nullptr); }
     };
     using optimize_function = Result (*)(const ForestStats &stats,
@@ -33,7 +33,9 @@ CompiledFunction::CompiledFunction(const Function &function_in, PassParams pass_
     : _llvm_wrapper(),
       _address(nullptr),
       _num_params(function_in.num_params()),
-      _pass_params(pass_params_in)
+      _pass_params(pass_params_in),
+      _batch_forest(nullptr),
+      _batch_eval(nullptr)
 {
     size_t id = _llvm_wrapper.make_function(function_in.num_params(),
                                             _pass_params,
@@ -41,15 +43,45 @@ CompiledFunction::CompiledFunction(const Function &function_in, PassParams pass_
                                             forest_optimizers);
     _llvm_wrapper.compile();
     _address = _llvm_wrapper.get_function_address(id);
+    // a root forest is optimized before anything else is generated,
+    // which makes it the first (and only) forest owned by the wrapper
+    if ((_pass_params == PassParams::ARRAY) && function_in.root().is_forest() &&
+        !_llvm_wrapper.get_forests().empty())
+    {
+        _batch_forest = _llvm_wrapper.get_forests()[0].get();
+        _batch_eval = _llvm_wrapper.get_forest_batch_evals()[0];
+    }
 }
 
 CompiledFunction::CompiledFunction(CompiledFunction &&rhs)
     : _llvm_wrapper(std::move(rhs._llvm_wrapper)),
       _address(rhs._address),
       _num_params(rhs._num_params),
-      _pass_params(rhs._pass_params)
+      _pass_params(rhs._pass_params),
+      _batch_forest(rhs._batch_forest),
+      _batch_eval(rhs._batch_eval)
 {
     rhs._address = nullptr;
+    rhs._batch_forest = nullptr;
+    rhs._batch_eval = nullptr;
+}
+
+void
+CompiledFunction::eval_batch(const double * const *params, size_t num_docs, double *result) const
+{
+    assert(_pass_params == PassParams::ARRAY);
+    if (_batch_eval != nullptr) {
+        _batch_eval(_batch_forest, params, num_docs, result);
+        return;
+    }
+    auto function = get_function();
+    std::vector<double> args(_num_params, 0.0);
+    for (size_t doc = 0; doc < num_docs; ++doc) {
+        for (size_t i = 0; i < _num_params; ++i) {
+            args[i] = params[i][doc];
+        }
+        result[doc] = function(args.data());
+    }
 }
 
 double
@@ -34,6 +34,8 @@ private:
     void       *_address;
     size_t      _num_params;
     PassParams  _pass_params;
+    const gbdt::Forest *_batch_forest;
+    gbdt::Forest::batch_eval_function _batch_eval;
 
 public:
     typedef std::unique_ptr<CompiledFunction> UP;
@@ -58,6 +60,17 @@ public:
         assert(_pass_params == PassParams::LAZY);
         return ((lazy_function)_address);
     }
+    /**
+     * Evaluate this function for multiple documents at once. The
+     * parameters are passed as one array of values per parameter
+     * (params[param][doc]), and one result is produced per
+     * document. Functions that are GBDT forests compiled by an
+     * optimizer with batch support (like VMForest) are evaluated by
+     * walking each tree for several documents in lock-step; other
+     * functions are evaluated one document at a time. Only
+     * available when using ARRAY params.
+     **/
+    void eval_batch(const double * const *params, size_t num_docs, double *result) const;
     const std::vector<gbdt::Forest::UP> &get_forests() const {
         return _llvm_wrapper.get_forests();
     }
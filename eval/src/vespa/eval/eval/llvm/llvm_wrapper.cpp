@@ -82,6 +82,7 @@ struct FunctionBuilder : public NodeVisitor, public NodeTraverser {
     const Node               *forest_end;
     const gbdt::Optimize::Chain &forest_optimizers;
     std::vector<gbdt::Forest::UP> &forests;
+    std::vector<gbdt::Forest::batch_eval_function> &forest_batch_evals;
     std::vector<PluginState::UP> &plugin_state;
 
     llvm::PointerType *make_eval_forest_funptr_t() {
@@ -126,6 +127,7 @@ struct FunctionBuilder : public NodeVisitor, public NodeTraverser {
                     PassParams pass_params_in,
                     const gbdt::Optimize::Chain &forest_optimizers_in,
                     std::vector<gbdt::Forest::UP> &forests_out,
+                    std::vector<gbdt::Forest::batch_eval_function> &forest_batch_evals_out,
                     std::vector<PluginState::UP> &plugin_state_out)
         : context(context_in),
           module(module_in),
@@ -140,6 +142,7 @@ struct FunctionBuilder : public NodeVisitor, public NodeTraverser {
           forest_end(nullptr),
           forest_optimizers(forest_optimizers_in),
           forests(forests_out),
+          forest_batch_evals(forest_batch_evals_out),
           plugin_state(plugin_state_out)
     {
         std::vector<llvm::Type*> param_types;
@@ -224,6 +227,7 @@ struct FunctionBuilder : public NodeVisitor, public NodeTraverser {
             return false;
         }
         forests.push_back(std::move(optimize_result.forest));
+        forest_batch_evals.push_back(optimize_result.batch_eval);
         void *eval_ptr = (void *) optimize_result.eval;
         gbdt::Forest *forest = forests.back().get();
         llvm::PointerType *eval_funptr_t = make_eval_forest_funptr_t();
@@ -649,6 +653,7 @@ LLVMWrapper::LLVMWrapper()
       _engine(),
       _functions(),
       _forests(),
+      _forest_batch_evals(),
       _plugin_state()
 {
     std::lock_guard<std::recursive_mutex> guard(_global_llvm_lock);
@@ -666,7 +671,7 @@ LLVMWrapper::make_function(size_t num_params, PassParams pass_params, const Node
     FunctionBuilder builder(*_context, *_module,
                             vespalib::make_string("f%zu", function_id),
                             num_params, pass_params,
-                            forest_optimizers, _forests, _plugin_state);
+                            forest_optimizers, _forests, _forest_batch_evals, _plugin_state);
     builder.build_root(root);
     _functions.push_back(builder.build());
     return function_id;
@@ -680,7 +685,7 @@ LLVMWrapper::make_forest_fragment(size_t num_params, const std::vector<const Nod
     FunctionBuilder builder(*_context, *_module,
                             vespalib::make_string("f%zu", function_id),
                             num_params, PassParams::ARRAY,
-                            gbdt::Optimize::none, _forests, _plugin_state);
+                            gbdt::Optimize::none, _forests, _forest_batch_evals, _plugin_state);
     builder.build_forest_fragment(fragment);
     _functions.push_back(builder.build());
     return function_id;
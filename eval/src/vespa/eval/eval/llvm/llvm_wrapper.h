@@ -47,6 +47,7 @@ private:
     std::unique_ptr<llvm::ExecutionEngine> _engine;
     std::vector<llvm::Function*>           _functions;
     std::vector<gbdt::Forest::UP>          _forests;
+    std::vector<gbdt::Forest::batch_eval_function> _forest_batch_evals;
     std::vector<PluginState::UP>           _plugin_state;
 
     static std::recursive_mutex _global_llvm_lock;
@@ -59,6 +60,8 @@ public:
                          const gbdt::Optimize::Chain &forest_optimizers);
     size_t make_forest_fragment(size_t num_params, const std::vector<const nodes::Node *> &fragment);
     const std::vector<gbdt::Forest::UP> &get_forests() const { return _forests; }
+    // batch entry point for each forest in get_forests() (nullptr if not supported)
+    const std::vector<gbdt::Forest::batch_eval_function> &get_forest_batch_evals() const { return _forest_batch_evals; }
     void compile(bool dump_module = false);
     void *get_function_address(size_t function_id);
     ~LLVMWrapper();
@@ -0,0 +1,145 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "quick_scorer.h"
+#include <vespa/eval/eval/basic_nodes.h>
+#include <vespa/eval/eval/call_nodes.h>
+#include <vespa/eval/eval/operator_nodes.h>
+#include <algorithm>
+
+namespace vespalib {
+namespace eval {
+namespace gbdt {
+
+namespace {
+
+//-----------------------------------------------------------------------------
+
+struct Check {
+    uint32_t param;
+    double threshold;
+    uint32_t tree;
+    uint64_t mask;
+    bool operator<(const Check &rhs) const {
+        if (param != rhs.param) {
+            return (param < rhs.param);
+        }
+        return (threshold < rhs.threshold);
+    }
+};
+
+// Number the leaves of a tree from left to right (true branch
+// first). Each less check produces a mask clearing the leaves of its
+// true branch, to be applied when the check is false.
+bool collect_checks(const nodes::Node &node, uint32_t tree, uint32_t &num_leaves,
+                    std::vector<double> &leaves_out, std::vector<Check> &checks_out)
+{
+    auto if_node = nodes::as<nodes::If>(node);
+    if (!if_node) {
+        if (!node.is_const() || (num_leaves >= QuickScorer::MAX_LEAVES)) {
+            return false;
+        }
+        leaves_out.push_back(node.get_const_value());
+        ++num_leaves;
+        return true;
+    }
+    auto less = nodes::as<nodes::Less>(if_node->cond());
+    if (!less || !less->rhs().is_const()) {
+        return false;
+    }
+    auto symbol = nodes::as<nodes::Symbol>(less->lhs());
+    if (!symbol || (symbol->id() < 0)) {
+        return false;
+    }
+    uint32_t first = num_leaves;
+    if (!collect_checks(if_node->true_expr(), tree, num_leaves, leaves_out, checks_out)) {
+        return false;
+    }
+    uint64_t true_leaves = ((uint64_t(1) << (num_leaves - first)) - 1) << first;
+    checks_out.push_back(Check{uint32_t(symbol->id()), less->rhs().get_const_value(), tree, ~true_leaves});
+    return collect_checks(if_node->false_expr(), tree, num_leaves, leaves_out, checks_out);
+}
+
+//-----------------------------------------------------------------------------
+
+} // namespace vespalib::eval::gbdt::<unnamed>
+
+//-----------------------------------------------------------------------------
+
+bool
+QuickScorer::add_trees(const std::vector<const nodes::Node *> &trees)
+{
+    for (size_t first = 0; first < trees.size(); first += BLOCK_SIZE) {
+        size_t block_size = std::min(BLOCK_SIZE, trees.size() - first);
+        std::vector<Check> checks;
+        for (size_t i = 0; i < block_size; ++i) {
+            uint32_t num_leaves = 0;
+            _leaf_offsets.push_back(_leaves.size());
+            if (!collect_checks(*trees[first + i], i, num_leaves, _leaves, checks)) {
+                return false;
+            }
+        }
+        std::stable_sort(checks.begin(), checks.end());
+        size_t idx = 0;
+        for (size_t param = 0; param <= _num_params; ++param) {
+            _offsets.push_back(_thresholds.size());
+            while ((param < _num_params) && (idx < checks.size()) && (checks[idx].param == param)) {
+                _thresholds.push_back(checks[idx].threshold);
+                _masks.push_back(checks[idx].mask);
+                _trees.push_back(checks[idx].tree);
+                ++idx;
+            }
+        }
+        if (idx != checks.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Optimize::Result
+QuickScorer::optimize(const ForestStats &stats,
+                      const std::vector<const nodes::Node *> &trees)
+{
+    if ((stats.total_in_checks > 0) || (stats.tree_sizes.back().size > MAX_LEAVES)) {
+        return Optimize::Result();
+    }
+    std::unique_ptr<QuickScorer> forest(new QuickScorer(stats.num_params));
+    if (!forest->add_trees(trees)) {
+        return Optimize::Result();
+    }
+    return Optimize::Result(std::move(forest), eval);
+}
+
+double
+QuickScorer::eval(const Forest *forest, const double *input)
+{
+    const QuickScorer &self = *((const QuickScorer *)forest);
+    uint64_t leaves[BLOCK_SIZE];
+    const uint32_t *offsets = &self._offsets[0];
+    size_t num_trees = self._leaf_offsets.size();
+    double sum = 0.0;
+    for (size_t first = 0; first < num_trees; first += BLOCK_SIZE) {
+        size_t block_size = std::min(BLOCK_SIZE, num_trees - first);
+        std::fill(leaves, leaves + block_size, ~uint64_t(0));
+        for (size_t param = 0; param < self._num_params; ++param) {
+            double value = input[param];
+            uint32_t end = offsets[param + 1];
+            for (uint32_t i = offsets[param]; (i < end) && !(value < self._thresholds[i]); ++i) {
+                leaves[self._trees[i]] &= self._masks[i];
+            }
+        }
+        for (size_t i = 0; i < block_size; ++i) {
+            sum += self._leaves[self._leaf_offsets[first + i] + __builtin_ctzll(leaves[i])];
+        }
+        offsets += (self._num_params + 1);
+    }
+    return sum;
+}
+
+Optimize::Chain QuickScorer::optimize_chain({optimize});
+
+//-----------------------------------------------------------------------------
+
+} // namespace vespalib::eval::gbdt
+} // namespace vespalib::eval
+} // namespace vespalib
@@ -0,0 +1,53 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "gbdt.h"
+#include <cstdint>
+
+namespace vespalib {
+namespace eval {
+namespace gbdt {
+
+/**
+ * GBDT forest optimizer based on the QuickScorer algorithm. Instead
+ * of walking each tree from the root, all less checks in the forest
+ * are grouped by feature and sorted by threshold. Evaluation visits
+ * one feature at a time, and each check that is false removes the
+ * leaves of its true branch from a per-tree leaf bitmask. The leaf
+ * reached by a tree is the left-most leaf still present in its
+ * bitmask. Trees are processed in blocks to keep the bitmasks and
+ * the checks of a block in cache.
+ *
+ * Only forests with less checks and at most 64 leaves per tree are
+ * supported.
+ **/
+class QuickScorer : public Forest
+{
+public:
+    static constexpr size_t MAX_LEAVES = 64;
+    static constexpr size_t BLOCK_SIZE = 512;
+
+private:
+    size_t                _num_params;
+    std::vector<uint32_t> _offsets;      // (num_params + 1) check offsets per block
+    std::vector<double>   _thresholds;   // check threshold
+    std::vector<uint64_t> _masks;        // leaves kept when check is false
+    std::vector<uint32_t> _trees;        // tree (within block) for check
+    std::vector<uint32_t> _leaf_offsets; // first leaf value for each tree
+    std::vector<double>   _leaves;
+
+    bool add_trees(const std::vector<const nodes::Node *> &trees);
+
+public:
+    explicit QuickScorer(size_t num_params) : _num_params(num_params), _offsets(), _thresholds(),
+                                              _masks(), _trees(), _leaf_offsets(), _leaves() {}
+    static Optimize::Result optimize(const ForestStats &stats,
+                                     const std::vector<const nodes::Node *> &trees);
+    static double eval(const Forest *forest, const double *input);
+    static Optimize::Chain optimize_chain;
+};
+
+} // namespace vespalib::eval::gbdt
+} // namespace vespalib::eval
+} // namespace vespalib
@@ -5,6 +5,7 @@
 #include <vespa/eval/eval/basic_nodes.h>
 #include <vespa/eval/eval/call_nodes.h>
 #include <vespa/eval/eval/operator_nodes.h>
+#include <algorithm>
 
 namespace vespalib {
 namespace eval {
@@ -92,6 +93,83 @@ double general_find_leaf(const double *input, const uint32_t *pos, uint32_t node
 
 //-----------------------------------------------------------------------------
 
+// number of documents walking the same tree in lock-step
+constexpr size_t LANES = 8;
+
+uint32_t less_only_step(double value, const uint32_t *&pos, uint32_t) {
+    if (value < *as_double_ptr(pos + 1)) {
+        uint32_t node_type = (pos[0] & 0xf0) >> 4;
+        pos += 4;
+        return node_type;
+    } else {
+        uint32_t node_type = (pos[0] & 0xf);
+        pos += 4 + pos[3];
+        return node_type;
+    }
+}
+
+uint32_t general_step(double value, const uint32_t *&pos, uint32_t node_type) {
+    if (node_type == LESS) {
+        return less_only_step(value, pos, node_type);
+    }
+    size_t set_end = 2 + (2 * (pos[1] & 0xff));
+    if (find_in(value, as_double_ptr(pos + 2), as_double_ptr(pos + set_end))) {
+        node_type = (pos[0] & 0xf0) >> 4;
+        pos += set_end;
+    } else {
+        node_type = (pos[0] & 0xf);
+        pos += set_end + (pos[1] >> 8);
+    }
+    return node_type;
+}
+
+template <typename STEP>
+void find_leaves(const double * const *input, size_t offset, size_t num_lanes,
+                 const uint32_t *root, double *sum, STEP step)
+{
+    const uint32_t *pos[LANES];
+    uint32_t node_type[LANES];
+    uint32_t todo[LANES];
+    uint32_t root_type = (*root & 0xf00) >> 8;
+    for (size_t i = 0; i < num_lanes; ++i) {
+        pos[i] = root;
+        node_type[i] = root_type;
+        todo[i] = i;
+    }
+    size_t num_todo = num_lanes;
+    while (num_todo > 0) {
+        size_t next = 0;
+        for (size_t k = 0; k < num_todo; ++k) {
+            uint32_t i = todo[k];
+            node_type[i] = step(input[pos[i][0] >> 12][offset + i], pos[i], node_type[i]);
+            if (node_type[i] == LEAF) {
+                sum[offset + i] += *as_double_ptr(pos[i]);
+            } else {
+                todo[next++] = i;
+            }
+        }
+        num_todo = next;
+    }
+}
+
+template <typename STEP>
+void eval_batch(const std::vector<uint32_t> &model, const double * const *input,
+                size_t num_docs, double *result, STEP step)
+{
+    std::fill(result, result + num_docs, 0.0);
+    const uint32_t *pos = &model[0];
+    const uint32_t *end = pos + model.size();
+    while (pos < end) {
+        uint32_t tree_size = *pos++;
+        for (size_t offset = 0; offset < num_docs; offset += LANES) {
+            find_leaves(input, offset, std::min(LANES, num_docs - offset), pos, result, step);
+        }
+        pos += tree_size;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void encode_const(double value, std::vector<uint32_t> &model_out) {
     union {
         double   d[1];
@@ -180,13 +258,13 @@ void encode_tree(const nodes::Node &root_in, std::vector<uint32_t> &model_out) {
 //-----------------------------------------------------------------------------
 
 Optimize::Result optimize(const std::vector<const nodes::Node *> &trees,
-                          Forest::eval_function eval)
+                          Forest::eval_function eval, Forest::batch_eval_function batch_eval)
 {
     std::vector<uint32_t> model;
     for (const nodes::Node *tree: trees) {
         encode_tree(*tree, model);
     }
-    return Optimize::Result(Forest::UP(new VMForest(std::move(model))), eval);
+    return Optimize::Result(Forest::UP(new VMForest(std::move(model))), eval, batch_eval);
 }
 
 //-----------------------------------------------------------------------------
@@ -202,7 +280,7 @@ VMForest::less_only_optimize(const ForestStats &stats,
     if (stats.total_in_checks > 0) {
         return Optimize::Result();
     }
-    return optimize(trees, less_only_eval);
+    return optimize(trees, less_only_eval, less_only_eval_batch);
 }
 
 double
@@ -220,6 +298,13 @@ VMForest::less_only_eval(const Forest *forest, const double *input)
     return sum;
 }
 
+void
+VMForest::less_only_eval_batch(const Forest *forest, const double * const *input, size_t num_docs, double *result)
+{
+    const VMForest &self = *((const VMForest *)forest);
+    eval_batch(self._model, input, num_docs, result, less_only_step);
+}
+
 Optimize::Result
 VMForest::general_optimize(const ForestStats &stats,
                            const std::vector<const nodes::Node *> &trees)
@@ -227,7 +312,7 @@ VMForest::general_optimize(const ForestStats &stats,
     if (stats.max_set_size > 255) {
         return Optimize::Result();
     }
-    return optimize(trees, general_eval);
+    return optimize(trees, general_eval, general_eval_batch);
 }
 
 double
@@ -245,6 +330,13 @@ VMForest::general_eval(const Forest *forest, const double *input)
     return sum;
 }
 
+void
+VMForest::general_eval_batch(const Forest *forest, const double * const *input, size_t num_docs, double *result)
+{
+    const VMForest &self = *((const VMForest *)forest);
+    eval_batch(self._model, input, num_docs, result, general_step);
+}
+
 Optimize::Chain VMForest::optimize_chain({less_only_optimize, general_optimize});
 
 //-----------------------------------------------------------------------------
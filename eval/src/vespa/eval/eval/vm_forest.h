@@ -12,6 +12,10 @@ namespace gbdt {
  * GBDT forest optimizer using a compact tree representation combined
  * with a leaf-node search and aggregate evaluation strategy. This
  * code is very similar to the old VM instruction for MLR expressions.
+ *
+ * The batch evaluation functions walk each tree for several documents
+ * in lock-step (one lane per document), which lets the cpu overlap
+ * the otherwise serial chains of compares and model loads.
  **/
 class VMForest : public Forest
 {
@@ -23,9 +27,11 @@ public:
     static Optimize::Result less_only_optimize(const ForestStats &stats,
                                                const std::vector<const nodes::Node *> &trees);
     static double less_only_eval(const Forest *forest, const double *);
+    static void less_only_eval_batch(const Forest *forest, const double * const *, size_t num_docs, double *result);
     static Optimize::Result general_optimize(const ForestStats &stats,
                                              const std::vector<const nodes::Node *> &trees);
     static double general_eval(const Forest *forest, const double *);
+    static void general_eval_batch(const Forest *forest, const double * const *, size_t num_docs, double *result);
     static Optimize::Chain optimize_chain;
 };
 
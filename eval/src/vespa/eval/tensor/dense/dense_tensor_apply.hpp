@@ -10,10 +10,30 @@ namespace vespalib {
 namespace tensor {
 namespace dense {
 
+/*
+ * Tensors with the same type have all cells in common, so the result
+ * can be calculated one cell at a time without combining addresses.
+ */
+template <typename Function>
+std::unique_ptr<Tensor>
+applySameType(const DenseTensorView &lhs, const DenseTensorView &rhs, Function &&func)
+{
+    DenseTensorView::CellsRef lhsCells = lhs.cellsRef();
+    DenseTensorView::CellsRef rhsCells = rhs.cellsRef();
+    DenseTensor::Cells cells(lhsCells.size());
+    for (size_t i = 0; i < cells.size(); ++i) {
+        cells[i] = func(lhsCells[i], rhsCells[i]);
+    }
+    return std::make_unique<DenseTensor>(lhs.type(), std::move(cells));
+}
+
 template <typename Function>
 std::unique_ptr<Tensor>
 apply(const DenseTensorView &lhs, const DenseTensorView &rhs, Function &&func)
 {
+    if ((lhs.type() == rhs.type()) && (lhs.cellsRef().size() == rhs.cellsRef().size())) {
+        return applySameType(lhs, rhs, func);
+    }
     DenseTensorAddressCombiner combiner(lhs.type(), rhs.type());
     DirectDenseTensorBuilder builder(DenseTensorAddressCombiner::combineDimensions(lhs.type(), rhs.type()));
     for (DenseTensorCellsIterator lhsItr = lhs.cellsIterator(); lhsItr.valid(); lhsItr.next()) {
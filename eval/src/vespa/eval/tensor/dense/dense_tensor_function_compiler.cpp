@@ -2,6 +2,7 @@
 
 #include "dense_dot_product_function.h"
 #include "dense_tensor_function_compiler.h"
+#include "dense_xw_product_function.h"
 #include <vespa/eval/eval/operation_visitor.h>
 #include <vespa/eval/eval/operation_visitor.h>
 #include <vespa/vespalib/test/insertion_operators.h>
@@ -45,8 +46,8 @@ isCompatibleTensorsForDotProduct(const ValueType &lhsType, const ValueType &rhsT
 
 struct DotProductFunctionCompiler
 {
-    static TensorFunction::UP compile(Node_UP expr) {
-        const Reduce *reduce = as<Reduce>(*expr);
+    static TensorFunction::UP compile(const Node &expr) {
+        const Reduce *reduce = as<Reduce>(expr);
         if (reduce && isType<Add>(*reduce->op) && willReduceAllDimensions(reduce->dimensions)) {
             const Apply *apply = as<Apply>(*reduce->tensor);
             if (apply && isType<Mul>(*apply->op)) {
@@ -59,7 +60,76 @@ struct DotProductFunctionCompiler
                 }
             }
         }
-        return std::move(expr);
+        return TensorFunction::UP();
+    }
+};
+
+bool
+isBoundDenseTensor(const ValueType &type, size_t numDimensions)
+{
+    if (!type.is_dense() || (type.dimensions().size() != numDimensions)) {
+        return false;
+    }
+    for (const auto &dim : type.dimensions()) {
+        if (!dim.is_bound()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+isCompatibleTensorsForXWProduct(const ValueType &vectorType, const ValueType &matrixType,
+                                const vespalib::string &commonDimension)
+{
+    if (!isBoundDenseTensor(vectorType, 1) || !isBoundDenseTensor(matrixType, 2)) {
+        return false;
+    }
+    const auto &vectorDim = vectorType.dimensions()[0];
+    if (vectorDim.name != commonDimension) {
+        return false;
+    }
+    size_t matrixDimIdx = matrixType.dimension_index(commonDimension);
+    return ((matrixDimIdx != ValueType::Dimension::npos) &&
+            (matrixType.dimensions()[matrixDimIdx].size == vectorDim.size));
+}
+
+TensorFunction::UP
+createXWProduct(const ValueType &resultType, const Inject &vector, const Inject &matrix,
+                const vespalib::string &commonDimension)
+{
+    const ValueType &matrixType = matrix.result_type;
+    size_t commonDimIdx = matrixType.dimension_index(commonDimension);
+    size_t resultDimIdx = 1 - commonDimIdx;
+    return std::make_unique<DenseXWProductFunction>(resultType,
+                                                    vector.tensor_id,
+                                                    matrix.tensor_id,
+                                                    matrixType.dimensions()[commonDimIdx].size,
+                                                    matrixType.dimensions()[resultDimIdx].size,
+                                                    (commonDimIdx == 1));
+}
+
+struct XWProductFunctionCompiler
+{
+    static TensorFunction::UP compile(const Node &expr) {
+        const Reduce *reduce = as<Reduce>(expr);
+        if (reduce && isType<Add>(*reduce->op) && (reduce->dimensions.size() == 1)) {
+            const Apply *apply = as<Apply>(*reduce->tensor);
+            if (apply && isType<Mul>(*apply->op)) {
+                const Inject *lhsTensor = as<Inject>(*apply->lhs_tensor);
+                const Inject *rhsTensor = as<Inject>(*apply->rhs_tensor);
+                const vespalib::string &commonDimension = reduce->dimensions[0];
+                if (lhsTensor && rhsTensor) {
+                    if (isCompatibleTensorsForXWProduct(lhsTensor->result_type, rhsTensor->result_type, commonDimension)) {
+                        return createXWProduct(reduce->result_type, *lhsTensor, *rhsTensor, commonDimension);
+                    }
+                    if (isCompatibleTensorsForXWProduct(rhsTensor->result_type, lhsTensor->result_type, commonDimension)) {
+                        return createXWProduct(reduce->result_type, *rhsTensor, *lhsTensor, commonDimension);
+                    }
+                }
+            }
+        }
+        return TensorFunction::UP();
     }
 };
 
@@ -68,7 +138,14 @@ struct DotProductFunctionCompiler
 TensorFunction::UP
 DenseTensorFunctionCompiler::compile(Node_UP expr)
 {
-    return DotProductFunctionCompiler::compile(std::move(expr));
+    TensorFunction::UP result = DotProductFunctionCompiler::compile(*expr);
+    if (!result) {
+        result = XWProductFunctionCompiler::compile(*expr);
+    }
+    if (!result) {
+        return std::move(expr);
+    }
+    return result;
 }
 
 } // namespace tensor
@@ -0,0 +1,94 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "dense_xw_product_function.h"
+#include "dense_tensor.h"
+#include "dense_tensor_view.h"
+#include <vespa/eval/eval/value.h>
+#include <vespa/eval/tensor/tensor.h>
+#include <vespa/vespalib/util/stash.h>
+#include <cassert>
+
+namespace vespalib {
+namespace tensor {
+
+using CellsRef = DenseTensorView::CellsRef;
+
+DenseXWProductFunction::DenseXWProductFunction(const eval::ValueType &resultType,
+                                               size_t vectorId,
+                                               size_t matrixId,
+                                               size_t vectorSize,
+                                               size_t resultSize,
+                                               bool commonDimensionInnermost)
+    : _resultType(resultType),
+      _vectorId(vectorId),
+      _matrixId(matrixId),
+      _vectorSize(vectorSize),
+      _resultSize(resultSize),
+      _commonDimensionInnermost(commonDimensionInnermost),
+      _hwAccelerator(hwaccelrated::IAccelrated::getAccelrator())
+{
+}
+
+DenseXWProductFunction::~DenseXWProductFunction()
+{
+}
+
+namespace {
+
+CellsRef
+getCellsRef(const eval::Value &value)
+{
+    const Tensor *tensor = static_cast<const Tensor *>(value.as_tensor());
+    const DenseTensorView *denseTensor = static_cast<const DenseTensorView *>(tensor);
+    return denseTensor->cellsRef();
+}
+
+void
+multiplyInnerCommon(const double *vectorCells, const double *matrixCells,
+                    size_t vectorSize, size_t resultSize, double *result,
+                    const hwaccelrated::IAccelrated &hwAccelerator)
+{
+    for (size_t i = 0; i < resultSize; ++i) {
+        result[i] = hwAccelerator.dotProduct(vectorCells, matrixCells, vectorSize);
+        matrixCells += vectorSize;
+    }
+}
+
+void
+multiplyOuterCommon(const double *vectorCells, const double *matrixCells,
+                    size_t vectorSize, size_t resultSize, double *result)
+{
+    for (size_t i = 0; i < resultSize; ++i) {
+        result[i] = 0.0;
+    }
+    for (size_t c = 0; c < vectorSize; ++c) {
+        const double scale = vectorCells[c];
+        for (size_t i = 0; i < resultSize; ++i) {
+            result[i] += (scale * matrixCells[i]);
+        }
+        matrixCells += resultSize;
+    }
+}
+
+}
+
+const eval::Value &
+DenseXWProductFunction::eval(const Input &input, Stash &stash) const
+{
+    CellsRef vectorCells = getCellsRef(input.get_tensor(_vectorId));
+    CellsRef matrixCells = getCellsRef(input.get_tensor(_matrixId));
+    assert(vectorCells.size() == _vectorSize);
+    assert(matrixCells.size() == (_vectorSize * _resultSize));
+    DenseTensor::Cells result(_resultSize);
+    if (_commonDimensionInnermost) {
+        multiplyInnerCommon(vectorCells.cbegin(), matrixCells.cbegin(),
+                            _vectorSize, _resultSize, result.data(), *_hwAccelerator);
+    } else {
+        multiplyOuterCommon(vectorCells.cbegin(), matrixCells.cbegin(),
+                            _vectorSize, _resultSize, result.data());
+    }
+    return stash.create<eval::TensorValue>(std::make_unique<DenseTensor>(_resultType, std::move(result)));
+}
+
+} // namespace tensor
+} // namespace vespalib
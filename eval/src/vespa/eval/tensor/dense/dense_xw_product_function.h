@@ -0,0 +1,51 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/eval/eval/tensor_function.h>
+#include <vespa/vespalib/hwaccelrated/iaccelrated.h>
+
+namespace vespalib {
+namespace tensor {
+
+/**
+ * Tensor function for a product between a 1-dimensional dense vector
+ * and a 2-dimensional dense matrix, summing over the dimension they
+ * have in common (xw product). The result is a 1-dimensional dense
+ * tensor with the other dimension of the matrix.
+ *
+ * If the common dimension is the inner dimension of the matrix, each
+ * result cell is a dot product between the vector and a matrix
+ * row. Otherwise, the result is accumulated by adding scaled matrix
+ * rows. Both loops work on contiguous cells.
+ */
+class DenseXWProductFunction : public eval::TensorFunction
+{
+private:
+    eval::ValueType _resultType;
+    size_t _vectorId;
+    size_t _matrixId;
+    size_t _vectorSize;
+    size_t _resultSize;
+    bool _commonDimensionInnermost;
+    hwaccelrated::IAccelrated::UP _hwAccelerator;
+
+public:
+    DenseXWProductFunction(const eval::ValueType &resultType,
+                           size_t vectorId,
+                           size_t matrixId,
+                           size_t vectorSize,
+                           size_t resultSize,
+                           bool commonDimensionInnermost);
+    ~DenseXWProductFunction();
+
+    size_t vectorId() const { return _vectorId; }
+    size_t matrixId() const { return _matrixId; }
+    size_t vectorSize() const { return _vectorSize; }
+    size_t resultSize() const { return _resultSize; }
+    bool commonDimensionInnermost() const { return _commonDimensionInnermost; }
+    virtual const eval::Value &eval(const Input &input, Stash &stash) const override;
+};
+
+} // namespace tensor
+} // namespace vespalib
@@ -60,6 +60,7 @@ public:
     bool Open(unsigned int openFlags, const char *filename) override;
     bool Close() override;
     bool IsOpened() const override { return _filedes >= 0; }
+    int getFileDescriptor() const { return _filedes; }
 
     void enableMemoryMap(int flags) override {
         _mmapEnabled = true;
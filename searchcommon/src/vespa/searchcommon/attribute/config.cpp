@@ -13,6 +13,7 @@ Config::Config() :
     _enableOnlyBitVector(false),
     _isFilter(false),
     _fastAccess(false),
+    _mmapLoad(false),
     _growStrategy(),
     _compactionStrategy(),
     _predicateParams(),
@@ -32,6 +33,7 @@ Config::Config(BasicType bt,
       _enableOnlyBitVector(false),
       _isFilter(false),
       _fastAccess(false),
+      _mmapLoad(false),
       _growStrategy(),
       _compactionStrategy(),
       _predicateParams(),
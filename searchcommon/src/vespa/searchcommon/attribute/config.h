@@ -49,6 +49,13 @@ public:
      */
     bool fastAccess() const { return _fastAccess; }
 
+    /**
+     * Check if this attribute should be loaded by mapping the saved
+     * data file copy-on-write instead of reading it into memory.
+     * Only supported for single value numeric attributes without fast search.
+     */
+    bool mmapLoad() const { return _mmapLoad; }
+
     const GrowStrategy & getGrowStrategy() const { return _growStrategy; }
     const CompactionStrategy &getCompactionStrategy() const { return _compactionStrategy; }
     void setHuge(bool v)                         { _huge = v; }
@@ -84,6 +91,7 @@ public:
     }
 
     void setFastAccess(bool v) { _fastAccess = v; }
+    void setMMapLoad(bool v) { _mmapLoad = v; }
     Config & setGrowStrategy(const GrowStrategy &gs) { _growStrategy = gs; return *this; }
     Config &setCompactionStrategy(const CompactionStrategy &compactionStrategy) { _compactionStrategy = compactionStrategy; return *this; }
     bool operator!=(const Config &b) const { return !(operator==(b)); }
@@ -99,6 +107,7 @@ public:
                _enableOnlyBitVector == b._enableOnlyBitVector &&
                _isFilter == b._isFilter &&
                _fastAccess == b._fastAccess &&
+               _mmapLoad == b._mmapLoad &&
                _growStrategy == b._growStrategy &&
                _compactionStrategy == b._compactionStrategy &&
                _predicateParams == b._predicateParams &&
@@ -115,6 +124,7 @@ private:
     bool           _enableOnlyBitVector;
     bool           _isFilter;
     bool           _fastAccess;
+    bool           _mmapLoad;
     GrowStrategy   _growStrategy;
     CompactionStrategy _compactionStrategy;
     PredicateParams    _predicateParams;
@@ -10,6 +10,7 @@
 #include <vespa/searchcore/grouping/groupingmanager.h>
 #include <vespa/searchcore/grouping/groupingsession.h>
 #include <vespa/searchcore/proton/matching/sessionmanager.h>
+#include <vespa/vespalib/util/simple_thread_bundle.h>
 #include <iostream>
 
 using namespace search::attribute;
@@ -508,6 +509,51 @@ TEST_F("test grouping fork/join", DoomFixture()) {
     EXPECT_EQUAL(expect.asString(), list[0]->asString());
 }
 
+GroupingContext::UP
+forkJoinGroupings(MyWorld &world, GroupingContext &context, vespalib::ThreadBundle *threadBundle)
+{
+    for (uint32_t id = 0; id < 3; ++id) {
+        Grouping request;
+        request.setId(id)
+               .setRoot(Group().addResult(SumAggregationResult().setExpression(MU<AttributeNode>("attr0"))))
+               .addLevel(createGL(id + 1, MU<AttributeNode>("attr0")))
+               .setFirstLevel(0)
+               .setLastLevel(1);
+        context.addGrouping(GroupingContext::GroupingPtr(new Grouping(request)));
+    }
+    GroupingSession session(SessionId(), context, world.attributeContext);
+    session.prepareThreadContextCreation(2);
+    GroupingContext::UP ctx0 = session.createThreadContext(0, world.attributeContext);
+    GroupingContext::UP ctx1 = session.createThreadContext(1, world.attributeContext);
+    doGrouping(*ctx0, 12, 30.0, 11, 20.0, 10, 10.0);
+    doGrouping(*ctx1, 22, 150.0, 21, 40.0, 20, 25.0);
+    GroupingManager man(*ctx0);
+    man.merge(*ctx1);
+    if (threadBundle != nullptr) {
+        man.prune(*threadBundle);
+    } else {
+        man.prune();
+    }
+    return ctx0;
+}
+
+TEST_F("require that groupings can be pruned in parallel after fork/join", DoomFixture()) {
+    MyWorld world;
+    world.basicSetup();
+    vespalib::SimpleThreadBundle threadBundle(2);
+    GroupingContext serialContext(f1.clock, f1.timeOfDoom);
+    GroupingContext parallelContext(f1.clock, f1.timeOfDoom);
+    GroupingContext::UP serial = forkJoinGroupings(world, serialContext, nullptr);
+    GroupingContext::UP parallel = forkJoinGroupings(world, parallelContext, &threadBundle);
+    GroupingList &expect = serial->getGroupingList();
+    GroupingList &actual = parallel->getGroupingList();
+    ASSERT_EQUAL(3u, actual.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQUAL(i + 1, actual[i]->getRoot().getChildrenSize());
+        EXPECT_EQUAL(expect[i]->asString(), actual[i]->asString());
+    }
+}
+
 TEST_F("test session timeout", DoomFixture()) {
     MyWorld world;
     world.basicSetup();
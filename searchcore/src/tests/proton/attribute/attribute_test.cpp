@@ -432,6 +432,106 @@ TEST_F("require that attribute writer handles update", Fixture)
     }
 }
 
+/**
+ * Sequenced task executor that holds back tasks until they are
+ * explicitly run, to simulate a busy attribute field writer.
+ */
+class DeferredTaskExecutor : public ISequencedTaskExecutor
+{
+    ForegroundTaskExecutor _executor;
+    std::vector<vespalib::Executor::Task::UP> _tasks;
+public:
+    using ISequencedTaskExecutor::getExecutorId;
+
+    DeferredTaskExecutor() : _executor(1), _tasks() {}
+    uint32_t getExecutorId(uint64_t componentId) override { return _executor.getExecutorId(componentId); }
+    void executeTask(uint32_t, vespalib::Executor::Task::UP task) override { _tasks.push_back(std::move(task)); }
+    void sync() override { runTasks(); }
+    void runTasks() {
+        std::vector<vespalib::Executor::Task::UP> tasks;
+        tasks.swap(_tasks);
+        for (auto &task : tasks) {
+            task->run();
+        }
+    }
+    size_t numTasks() const { return _tasks.size(); }
+};
+
+struct BatchFixture
+{
+    DirectoryHandler _dirHandler;
+    DummyFileHeaderContext   _fileHeaderContext;
+    DeferredTaskExecutor     _attributeFieldWriter;
+    HwInfo                   _hwInfo;
+    proton::AttributeManager::SP _m;
+    std::unique_ptr<AttributeWriter> _aw;
+
+    BatchFixture()
+        : _dirHandler(test_dir),
+          _fileHeaderContext(),
+          _attributeFieldWriter(),
+          _hwInfo(),
+          _m(std::make_shared<proton::AttributeManager>
+             (test_dir, "test.subdb", TuneFileAttributes(),
+              _fileHeaderContext, _attributeFieldWriter, _hwInfo)),
+          _aw()
+    {
+    }
+    AttributeVector::SP addAttribute(const vespalib::string &name) {
+        auto ret = _m->addAttribute({name, AVConfig(AVBasicType::INT32)}, createSerialNum);
+        _aw = std::make_unique<AttributeWriter>(_m);
+        return ret;
+    }
+};
+
+void
+assertIntValue(const AttributeVector &attr, uint32_t lid, int64_t expValue)
+{
+    attribute::IntegerContent ibuf;
+    ibuf.fill(attr, lid);
+    EXPECT_EQUAL(1u, ibuf.size());
+    EXPECT_EQUAL(expValue, ibuf[0]);
+}
+
+TEST_F("require that attribute writer applies queued updates as one batch", BatchFixture)
+{
+    AttributeVector::SP a1 = f.addAttribute("a1");
+    AttributeVector::SP a2 = f.addAttribute("a2");
+    fillAttribute(a1, 1, 10, 1);
+    fillAttribute(a2, 1, 20, 1);
+
+    Schema schema;
+    schema.addAttributeField(Schema::AttributeField("a1", schema::DataType::INT32, CollectionType::SINGLE));
+    schema.addAttributeField(Schema::AttributeField("a2", schema::DataType::INT32, CollectionType::SINGLE));
+    DocBuilder idb(schema);
+    DocumentUpdate upd(idb.getDocumentType(), DocumentId("doc::1"));
+    upd.addUpdate(FieldUpdate(upd.getType().getField("a1"))
+                  .addUpdate(ArithmeticValueUpdate(ArithmeticValueUpdate::Add, 5)));
+    upd.addUpdate(FieldUpdate(upd.getType().getField("a2"))
+                  .addUpdate(ArithmeticValueUpdate(ArithmeticValueUpdate::Add, 10)));
+
+    for (SerialNum serialNum = 2; serialNum < 12; ++serialNum) {
+        f._aw->update(serialNum, upd, 1, true, emptyCallback);
+    }
+    EXPECT_EQUAL(1u, f._attributeFieldWriter.numTasks());
+    TEST_DO(assertIntValue(*a1, 1, 10));
+    f._attributeFieldWriter.runTasks();
+    TEST_DO(assertIntValue(*a1, 1, 60));
+    TEST_DO(assertIntValue(*a2, 1, 120));
+    EXPECT_EQUAL(11u, a1->getStatus().getLastSyncToken());
+    EXPECT_EQUAL(11u, a2->getStatus().getLastSyncToken());
+
+    // A commit closes the open batch
+    f._aw->update(12, upd, 1, false, emptyCallback);
+    f._aw->commit(12, emptyCallback);
+    f._aw->update(13, upd, 1, true, emptyCallback);
+    EXPECT_EQUAL(3u, f._attributeFieldWriter.numTasks());
+    f._attributeFieldWriter.runTasks();
+    TEST_DO(assertIntValue(*a1, 1, 70));
+    TEST_DO(assertIntValue(*a2, 1, 140));
+    EXPECT_EQUAL(13u, a1->getStatus().getLastSyncToken());
+}
+
 TEST_F("require that attribute writer handles predicate update", Fixture)
 {
     AttributeVector::SP a1 = f.addAttribute({"a1", AVConfig(AVBasicType::PREDICATE)}, createSerialNum);
@@ -205,7 +205,7 @@ struct MySearchableConfig
 {
 	SearchableConfig _cfg;
 	MySearchableConfig()
-	    : _cfg(MyFastAccessConfig<false>()._cfg, 1)
+	    : _cfg(MyFastAccessConfig<false>()._cfg, 1, 1)
 	{
 	}
 };
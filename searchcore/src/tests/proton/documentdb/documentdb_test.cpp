@@ -251,6 +251,25 @@ TEST_F("require that session manager can be explored", Fixture)
     EXPECT_TRUE(DocumentDBExplorer(f._db).get_child("session").get() != nullptr);    
 }
 
+TEST_F("require that initializer progress can be explored", Fixture)
+{
+    Slime state;
+    SlimeInserter inserter(state);
+    DocumentDBExplorer(f._db).get_child("initializer")->get_state(inserter, true);
+    EXPECT_EQUAL(0, state.get()["runningTasks"].asLong());
+    const Inspector &tasks = state.get()["tasks"];
+    EXPECT_EQUAL(state.get()["startedTasks"].asLong(), static_cast<int64_t>(tasks.entries()));
+    bool foundReadyDocumentMetaStore = false;
+    for (size_t i = 0; i < tasks.entries(); ++i) {
+        EXPECT_EQUAL("done", tasks[i]["state"].asString().make_string());
+        EXPECT_TRUE(tasks[i]["elapsedMs"].asLong() >= 0);
+        if (tasks[i]["name"].asString().make_string() == "0.ready.documentmetastore") {
+            foundReadyDocumentMetaStore = true;
+        }
+    }
+    EXPECT_TRUE(foundReadyDocumentMetaStore);
+}
+
 TEST_F("require that document db registers reference", Fixture)
 {
     auto &registry = f._myDBOwner._registry;
@@ -20,6 +20,7 @@
 #include <vespa/searchcore/proton/server/ddbstate.h>
 #include <vespa/searchcore/proton/server/executorthreadingservice.h>
 #include <vespa/searchcore/proton/server/feedhandler.h>
+#include <vespa/searchcore/proton/server/feedstates.h>
 #include <vespa/searchcore/proton/server/i_feed_handler_owner.h>
 #include <vespa/searchcore/proton/server/ireplayconfig.h>
 #include <vespa/searchcore/proton/test/dummy_feed_view.h>
@@ -51,6 +52,8 @@ using search::SerialNum;
 using search::index::schema::CollectionType;
 using search::index::schema::DataType;
 using search::makeLambdaTask;
+using search::transactionlog::Packet;
+using search::transactionlog::RPC;
 using search::transactionlog::TransLogServer;
 using storage::spi::PartitionId;
 using storage::spi::RemoveResult;
@@ -189,6 +192,7 @@ struct MyFeedView : public test::DummyFeedView {
     MyDocumentMetaStore metaStore;
     int put_count;
     SerialNum put_serial;
+    std::vector<SerialNum> put_serials;
     int heartbeat_count;
     int remove_count;
     int move_count;
@@ -218,6 +222,7 @@ struct MyFeedView : public test::DummyFeedView {
         }
         ++put_count;
         put_serial = putOp.getSerialNum();
+        put_serials.push_back(putOp.getSerialNum());
         metaStore.allocate(putOp.getDocument()->getId().getGlobalId());
         if (putLatch.get() != NULL) {
             putLatch->countDown();
@@ -251,6 +256,7 @@ MyFeedView::MyFeedView(const DocumentTypeRepo::SP &dtr)
       metaStore(),
       put_count(0),
       put_serial(0),
+      put_serials(),
       heartbeat_count(0),
       remove_count(0),
       move_count(0),
@@ -706,6 +712,43 @@ TEST_F("require that remove is NOT rejected if resource limit is reached", FeedH
 
 }  // namespace
 
+TEST_F("require that replayed operations are deserialized in parallel and applied in serial order",
+       FeedHandlerFixture)
+{
+    MyConfigStore config_store;
+    IFeedView *feed_view_ptr = &f.feedView;
+    ReplayTransactionLogState state(f.schema.getDocType().getName(), feed_view_ptr, f._bucketDBHandler,
+                                    f.replayConfig, config_store, 4);
+    Packet packet(0x100000);
+    SerialNum serial = 10;
+    for (uint32_t i = 0; i < 100; ++i) {
+        vespalib::nbostream os;
+        if (i == 50) {
+            NewConfigOperation op(serial, config_store);
+            op.serialize(os);
+            EXPECT_TRUE(packet.add(Packet::Entry(serial, op.getType(), vespalib::ConstBufferRef(os.c_str(), os.size()))));
+        } else {
+            DocumentContext doc_context(vespalib::make_string("id:test:searchdocument::%u", i), *f.schema.builder);
+            PutOperation op(doc_context.bucketId, Timestamp(serial), doc_context.doc);
+            op.serialize(os);
+            EXPECT_TRUE(packet.add(Packet::Entry(serial, op.getType(), vespalib::ConstBufferRef(os.c_str(), os.size()))));
+        }
+        ++serial;
+    }
+    TlsReplayProgress progress("test", 10, serial - 1);
+    auto wrap = std::make_shared<PacketWrapper>(packet, &progress);
+    state.receive(wrap, f.writeService.master());
+    wrap->gate.await();
+    EXPECT_EQUAL(RPC::OK, wrap->result);
+    EXPECT_EQUAL(99, f.feedView.put_count);
+    ASSERT_EQUAL(99u, f.feedView.put_serials.size());
+    EXPECT_TRUE(std::is_sorted(f.feedView.put_serials.begin(), f.feedView.put_serials.end()));
+    EXPECT_EQUAL(serial - 1, f.feedView.put_serial);
+    EXPECT_EQUAL(100u, progress.getNumOperations());
+    EXPECT_EQUAL(serial - 1, progress.getCurrent());
+    EXPECT_EQUAL(1.0, progress.getProgress());
+}
+
 TEST_MAIN()
 {
     DummyFileHeaderContext::setCreator("feedhandler_test");
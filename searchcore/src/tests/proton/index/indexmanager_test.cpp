@@ -176,7 +176,7 @@ Document::UP Fixture::addDocument(uint32_t id) {
 void Fixture::resetIndexManager() {
     _index_manager.reset(0);
     _index_manager.reset(
-            new IndexManager(index_dir, searchcorespi::index::WarmupConfig(), 2, 0, getSchema(), 1,
+            new IndexManager(index_dir, searchcorespi::index::WarmupConfig(), 2, 0, 1, 0, 1, getSchema(), 1,
                              _reconfigurer, _writeService, _writeService.getMasterExecutor(),
                              TuneFileIndexManager(), TuneFileAttributes(),
                              _fileHeaderContext));
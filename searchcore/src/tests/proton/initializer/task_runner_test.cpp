@@ -6,8 +6,11 @@ LOG_SETUP("task_runner_test");
 #include <vespa/searchcore/proton/initializer/task_runner.h>
 #include <vespa/vespalib/util/threadstackexecutor.h>
 #include <vespa/vespalib/stllike/string.h>
+#include <atomic>
 #include <mutex>
+#include <thread>
 
+using proton::initializer::InitializerProgress;
 using proton::initializer::InitializerTask;
 using proton::initializer::TaskRunner;
 
@@ -44,6 +47,39 @@ public:
     }
 
     virtual void run() override { _log.append(_name); }
+    virtual vespalib::string getName() const override { return _name; }
+};
+
+struct ConcurrencyTracker
+{
+    std::atomic<uint32_t> _running;
+    std::atomic<uint32_t> _maxRunning;
+
+    ConcurrencyTracker()
+        : _running(0u),
+          _maxRunning(0u)
+    {
+    }
+};
+
+class TrackedTask : public InitializerTask
+{
+    ConcurrencyTracker &_tracker;
+public:
+    TrackedTask(ConcurrencyTracker &tracker)
+        : _tracker(tracker)
+    {
+    }
+
+    virtual void run() override {
+        uint32_t running = ++_tracker._running;
+        uint32_t maxRunning = _tracker._maxRunning;
+        while (running > maxRunning &&
+               !_tracker._maxRunning.compare_exchange_weak(maxRunning, running)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        --_tracker._running;
+    }
 };
 
 
@@ -91,11 +127,13 @@ TestJob::~TestJob() {}
 struct Fixture
 {
     vespalib::ThreadStackExecutor _executor;
+    InitializerProgress::SP _progress;
     TaskRunner _taskRunner;
 
-    Fixture(uint32_t numThreads = 1)
+    Fixture(uint32_t numThreads = 1, uint32_t maxConcurrentTasks = 0)
         : _executor(numThreads, 128 * 1024),
-          _taskRunner(_executor)
+          _progress(std::make_shared<InitializerProgress>()),
+          _taskRunner(_executor, maxConcurrentTasks, _progress)
     {
     }
 
@@ -138,6 +176,49 @@ TEST_F("multiple threads, dag graph", Fixture(10))
     LOG(info, "dabc=%d, dbac=%d", dabc_count, dbac_count);
 }
 
+InitializerTask::SP
+setupTrackedTasks(ConcurrencyTracker &tracker, uint32_t numTasks)
+{
+    InitializerTask::SP root(std::make_shared<TrackedTask>(tracker));
+    for (uint32_t i = 0; i < numTasks; ++i) {
+        root->addDependency(std::make_shared<TrackedTask>(tracker));
+    }
+    return root;
+}
+
+TEST_F("multiple threads, max concurrent tasks limits running tasks", Fixture(10, 2))
+{
+    ConcurrencyTracker tracker;
+    f.run(setupTrackedTasks(tracker, 20));
+    EXPECT_EQUAL(0u, tracker._running.load());
+    EXPECT_LESS_EQUAL(tracker._maxRunning.load(), 2u);
+    EXPECT_GREATER(tracker._maxRunning.load(), 0u);
+}
+
+TEST_F("multiple threads, max concurrent tasks 1 runs tasks in sequence", Fixture(10, 1))
+{
+    ConcurrencyTracker tracker;
+    f.run(setupTrackedTasks(tracker, 20));
+    EXPECT_EQUAL(1u, tracker._maxRunning.load());
+}
+
+TEST_F("progress is recorded for named tasks", Fixture(10))
+{
+    TestJob job = TestJob::setupDiamond();
+    f.run(job._root);
+    auto tasks = f._progress->getTasks();
+    ASSERT_EQUAL(4u, tasks.size());
+    EXPECT_EQUAL("D", tasks[0].name);
+    EXPECT_EQUAL("C", tasks[3].name);
+    auto now = InitializerProgress::Clock::now();
+    for (const auto &task : tasks) {
+        EXPECT_TRUE(task.state == InitializerTask::State::DONE);
+        EXPECT_TRUE(task.startTime <= task.endTime);
+        EXPECT_TRUE(task.endTime <= now);
+        EXPECT_TRUE(task.elapsed(now).count() >= 0);
+    }
+}
+
 TEST_MAIN()
 {
     TEST_RUN_ALL();
@@ -138,6 +138,20 @@ struct AdaptiveSchedulerFactory : public SchedulerFactory {
     }
 };
 
+struct WorkStealingSchedulerFactory : public SchedulerFactory {
+    size_t num_threads;
+    size_t chunks_per_thread;
+    size_t num_nodes;
+    WorkStealingSchedulerFactory(size_t num_threads_in, size_t chunks_per_thread_in, size_t num_nodes_in)
+        : num_threads(num_threads_in), chunks_per_thread(chunks_per_thread_in), num_nodes(num_nodes_in) {}
+    vespalib::string desc() const override {
+        return make_string("work_stealing(threads:%zu,chunks_per_thread:%zu,nodes:%zu)", num_threads, chunks_per_thread, num_nodes);
+    }
+    DocidRangeScheduler::UP create(uint32_t docid_limit) const override {
+        return std::make_unique<WorkStealingDocidRangeScheduler>(num_threads, chunks_per_thread, num_nodes, docid_limit);
+    }
+};
+
 struct SchedulerList {
     std::vector<SchedulerFactory::UP> factory_list;
     SchedulerList(size_t num_threads) : factory_list() {
@@ -151,6 +165,9 @@ struct SchedulerList {
         factory_list.push_back(std::make_unique<AdaptiveSchedulerFactory>(num_threads, 100));
         factory_list.push_back(std::make_unique<AdaptiveSchedulerFactory>(num_threads, 10));
         factory_list.push_back(std::make_unique<AdaptiveSchedulerFactory>(num_threads, 1));
+        factory_list.push_back(std::make_unique<WorkStealingSchedulerFactory>(num_threads, 16, 1));
+        factory_list.push_back(std::make_unique<WorkStealingSchedulerFactory>(num_threads, 64, 1));
+        factory_list.push_back(std::make_unique<WorkStealingSchedulerFactory>(num_threads, 64, 2));
     }
 };
 
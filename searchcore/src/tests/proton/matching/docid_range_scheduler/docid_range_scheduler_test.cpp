@@ -2,7 +2,9 @@
 
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/searchcore/proton/matching/docid_range_scheduler.h>
+#include <algorithm>
 #include <chrono>
+#include <numeric>
 #include <thread>
 
 using namespace proton::matching;
@@ -305,4 +307,79 @@ TEST_MT_FF("require that the adaptive scheduler handles fewer documents than thr
 
 //-----------------------------------------------------------------------------
 
+TEST("require that the work stealing scheduler processes own chunks before stealing") {
+    WorkStealingDocidRangeScheduler scheduler(2, 4, 1, 17);
+    EXPECT_EQUAL(scheduler.total_span(0).begin, 1u);
+    EXPECT_EQUAL(scheduler.total_span(0).end, 17u);
+    EXPECT_EQUAL(scheduler.unassigned_size(), 16u);
+    TEST_DO(verify_range(scheduler.first_range(0), DocidRange(1,3)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(3,5)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(5,7)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(7,9)));
+    EXPECT_EQUAL(scheduler.unassigned_size(), 8u);
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(13,15)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(15,17)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(11,13)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(9,11)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange()));
+    TEST_DO(verify_range(scheduler.first_range(1), DocidRange()));
+    EXPECT_EQUAL(scheduler.unassigned_size(), 0u);
+    EXPECT_EQUAL(scheduler.total_size(0), 16u);
+    EXPECT_EQUAL(scheduler.total_size(1), 0u);
+}
+
+TEST("require that the work stealing scheduler steals within its own node first") {
+    WorkStealingDocidRangeScheduler scheduler(4, 1, 2, 9);
+    TEST_DO(verify_range(scheduler.first_range(1), DocidRange(3,5)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(1,3)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(5,7)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(7,9)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange()));
+}
+
+TEST("require that the work stealing scheduler does not use idle observer or range sharing") {
+    WorkStealingDocidRangeScheduler scheduler(4, 8, 1, 1000);
+    EXPECT_TRUE(scheduler.make_idle_observer().is_always_zero());
+    TEST_DO(verify_range(scheduler.share_range(0, DocidRange(10,20)), DocidRange(10,20)));
+}
+
+TEST_MT_FFF("require that the work stealing scheduler assigns all documents exactly once",
+            8, WorkStealingDocidRangeScheduler(num_threads, 16, 2, 10007),
+            std::vector<std::vector<DocidRange>>(num_threads), TimeBomb(60))
+{
+    for (DocidRange docid_range = f1.first_range(thread_id);
+         !docid_range.empty();
+         docid_range = f1.next_range(thread_id))
+    {
+        f2[thread_id].push_back(docid_range);
+        if (thread_id == 0) {
+            // slow thread; its chunks should be stolen by others
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    TEST_BARRIER();
+    if (thread_id == 0) {
+        std::vector<DocidRange> ranges;
+        size_t total = 0;
+        for (size_t i = 0; i < num_threads; ++i) {
+            EXPECT_EQUAL(f1.total_size(i), std::accumulate(f2[i].begin(), f2[i].end(), size_t(0),
+                            [](size_t sum, DocidRange r){ return sum + r.size(); }));
+            total += f1.total_size(i);
+            ranges.insert(ranges.end(), f2[i].begin(), f2[i].end());
+        }
+        EXPECT_EQUAL(total, 10006u);
+        EXPECT_EQUAL(f1.unassigned_size(), 0u);
+        std::sort(ranges.begin(), ranges.end(), [](DocidRange a, DocidRange b){ return (a.begin < b.begin); });
+        uint32_t expect_begin = 1;
+        for (DocidRange range: ranges) {
+            EXPECT_EQUAL(range.begin, expect_begin);
+            expect_begin = range.end;
+        }
+        EXPECT_EQUAL(expect_begin, 10007u);
+        EXPECT_LESS(f2[0].size(), 16u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -248,6 +248,35 @@ struct MyWorld {
                 .doc(600).doc(700).doc(800).doc(900));
     }
 
+    /**
+     * Results for a parallel wand term where the first documents have
+     * the highest possible score, so that all later documents are
+     * pruned once the score threshold has been raised.
+     **/
+    void wandResults(const vespalib::string &term) {
+        FakeResult result;
+        result.minMax(1, 100);
+        for (uint32_t docId = 2; docId < NUM_DOCS; docId += 2) { // source 0 only
+            int32_t weight = (docId <= 20) ? 100 : 50;
+            result.doc(docId).elem(0).weight(weight).pos(0);
+        }
+        searchContext.idx(0).getFake().addResult("f1", term, result);
+    }
+
+    SearchRequest::SP createWandRequest(const vespalib::string &field, const vespalib::string &term,
+                                        uint32_t targetNumHits)
+    {
+        QueryBuilder<ProtonNodeTypes> builder;
+        builder.addWandTerm(1, field, 1, search::query::Weight(1), targetNumHits, 0, 1.0);
+        builder.addStringTerm(term, field, 2, search::query::Weight(1));
+        vespalib::string stack_dump = StackDumpCreator::create(*builder.build());
+        SearchRequest::SP request(new SearchRequest);
+        request->setTimeout(60 * fastos::TimeStamp::SEC);
+        request->stackDump.assign(stack_dump.data(), stack_dump.data() + stack_dump.size());
+        request->maxhits = 10;
+        return request;
+    }
+
     void setStackDump(Request &request, const vespalib::string &field,
                       const vespalib::string &term) {
         QueryBuilder<ProtonNodeTypes> builder;
@@ -296,6 +325,16 @@ struct MyWorld {
         return rank_program->match_data().get_termwise_limit();
     }
 
+    bool first_phase_supports_batch(const SearchRequest &request) {
+        Matcher::SP matcher = createMatcher();
+        search::fef::Properties overrides;
+        MatchToolsFactory::UP match_tools_factory = matcher->create_match_tools_factory(
+                request, searchContext, attributeContext, metaStore, overrides);
+        MatchTools::UP match_tools = match_tools_factory->createMatchTools();
+        RankProgram::UP rank_program = match_tools->first_phase_program();
+        return rank_program->prepare_batch();
+    }
+
     SearchReply::UP performSearch(SearchRequest::SP req, size_t threads) {
         Matcher::SP matcher = createMatcher();
         SearchSession::OwnershipBundle owned_objects;
@@ -457,6 +496,50 @@ TEST("require that ranking is performed (multi-threaded)") {
     }
 }
 
+TEST("require that matching and ranking works with work stealing (multi-threaded)") {
+    for (size_t threads = 1; threads <= 16; ++threads) {
+        MyWorld world;
+        world.basicSetup(0, 0);
+        world.verbose_a1_result("all");
+        SearchRequest::SP request = world.createSimpleRequest("a1", "all");
+        search::fef::Properties &rankProperties = request->propertiesMap.lookupCreate(search::MapNames::RANK);
+        rankProperties.add("vespa.matching.workstealing.chunksperthread", "4");
+        rankProperties.add("vespa.matching.workstealing.numnodes", "2");
+        SearchReply::UP reply = world.performSearch(request, threads);
+        EXPECT_EQUAL(985u, world.matchingStats.docsMatched());
+        EXPECT_EQUAL(10u, reply->hits.size());
+    }
+    for (size_t threads = 1; threads <= 16; ++threads) {
+        MyWorld world;
+        world.basicSetup();
+        world.basicResults();
+        SearchRequest::SP request = world.createSimpleRequest("f1", "spread");
+        request->propertiesMap.lookupCreate(search::MapNames::RANK).add("vespa.matching.workstealing.chunksperthread", "8");
+        SearchReply::UP reply = world.performSearch(request, threads);
+        EXPECT_EQUAL(9u, world.matchingStats.docsMatched());
+        ASSERT_TRUE(reply->hits.size() == 9u);
+        EXPECT_EQUAL(document::DocumentId("doc::900").getGlobalId(),  reply->hits[0].gid);
+        EXPECT_EQUAL(900.0, reply->hits[0].metric);
+        EXPECT_EQUAL(document::DocumentId("doc::100").getGlobalId(),  reply->hits[8].gid);
+        EXPECT_EQUAL(100.0, reply->hits[8].metric);
+    }
+}
+
+TEST("require that parallel wand prunes hits when first phase ranking is calculated in batches") {
+    MyWorld world;
+    world.basicSetup();
+    world.wandResults("w");
+    SearchRequest::SP request = world.createWandRequest("f1", "w", 2);
+    EXPECT_TRUE(world.first_phase_supports_batch(*request));
+    SearchReply::UP reply = world.performSearch(request, 1);
+    // attribute(a1) as first phase ranking is calculated in batches,
+    // but the wand iterator must still be unpacked to raise its threshold.
+    EXPECT_GREATER(world.matchingStats.docsMatched(), 0u);
+    EXPECT_LESS(world.matchingStats.docsMatched(), 10u);
+    EXPECT_EQUAL(world.matchingStats.docsMatched(), world.matchingStats.docsRanked());
+    EXPECT_EQUAL(world.matchingStats.docsMatched(), reply->hits.size());
+}
+
 TEST("require that re-ranking is performed (multi-threaded)") {
     for (size_t threads = 1; threads <= 16; ++threads) {
         MyWorld world;
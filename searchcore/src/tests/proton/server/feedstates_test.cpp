@@ -18,6 +18,7 @@ LOG_SETUP("feedstates_test");
 #include <vespa/vespalib/testkit/testapp.h>
 #include <vespa/vespalib/util/buffer.h>
 #include <vespa/searchcore/proton/bucketdb/bucketdbhandler.h>
+#include <thread>
 
 using document::BucketId;
 using document::DocumentId;
@@ -140,6 +141,21 @@ TEST_F("require that replay progress is tracked", Fixture)
     EXPECT_EQUAL(0.5, progress.getProgress());
 }
 
+TEST("require that replay rate is frozen when replay is done")
+{
+    TlsReplayProgress progress("test", 5, 15);
+    progress.updateCurrent(6);
+    progress.updateCurrent(7);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    progress.markDone();
+    double opsPerSecond = progress.getOperationsPerSecond();
+    std::chrono::milliseconds elapsed = progress.getElapsed();
+    EXPECT_TRUE(opsPerSecond > 0.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQUAL(opsPerSecond, progress.getOperationsPerSecond());
+    EXPECT_EQUAL(elapsed.count(), progress.getElapsed().count());
+}
+
 }  // namespace
 
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -4,6 +4,7 @@
 #include <vespa/searchlib/aggregation/fs4hit.h>
 #include <vespa/searchlib/expression/attributenode.h>
 #include <vespa/searchcore/grouping/groupingsession.h>
+#include <vespa/vespalib/util/thread_bundle.h>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".groupingmanager");
@@ -16,6 +17,31 @@ using search::attribute::IAttributeContext;
 
 //-----------------------------------------------------------------------------
 
+namespace {
+
+void pruneGrouping(Grouping &g)
+{
+    g.postMerge();
+    g.sortById();
+}
+
+struct PruneTask : vespalib::Runnable {
+    GroupingContext::GroupingList &list;
+    size_t first;
+    size_t stride;
+    PruneTask(GroupingContext::GroupingList &list_in, size_t first_in, size_t stride_in)
+        : list(list_in), first(first_in), stride(stride_in) {}
+    void run() override {
+        for (size_t i = first; i < list.size(); i += stride) {
+            pruneGrouping(*list[i]);
+        }
+    }
+};
+
+} // namespace search::grouping::<unnamed>
+
+//-----------------------------------------------------------------------------
+
 GroupingManager::GroupingManager(GroupingContext & groupingContext)
     : _groupingContext(groupingContext)
 {
@@ -109,10 +135,27 @@ GroupingManager::prune()
 {
     GroupingContext::GroupingList &groupingList(_groupingContext.getGroupingList());
     for (size_t i = 0; i < groupingList.size(); ++i) {
-        Grouping &g = *groupingList[i];
-        g.postMerge();
-        g.sortById();
+        pruneGrouping(*groupingList[i]);
+    }
+}
+
+void
+GroupingManager::prune(vespalib::ThreadBundle &threadBundle)
+{
+    GroupingContext::GroupingList &groupingList(_groupingContext.getGroupingList());
+    size_t numTasks = std::min(groupingList.size(), threadBundle.size());
+    if (numTasks <= 1) {
+        prune();
+        return;
+    }
+    std::vector<PruneTask> tasks;
+    std::vector<vespalib::Runnable*> targets;
+    tasks.reserve(numTasks);
+    for (size_t i = 0; i < numTasks; ++i) {
+        tasks.emplace_back(groupingList, i, numTasks);
+        targets.push_back(&tasks.back());
     }
+    threadBundle.run(targets);
 }
 
 void
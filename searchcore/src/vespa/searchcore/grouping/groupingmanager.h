@@ -5,6 +5,8 @@
 #include <vespa/searchlib/aggregation/grouping.h>
 #include <vespa/searchcore/grouping/groupingcontext.h>
 
+namespace vespalib { struct ThreadBundle; }
+
 namespace search {
 
 namespace grouping {
@@ -83,6 +85,17 @@ public:
      **/
     void prune();
 
+    /**
+     * Same as prune, but the groupings are distributed across the
+     * threads in the given bundle, as each grouping is pruned
+     * independently of the others. A single grouping is still pruned
+     * by one thread, so requests with only one grouping get no
+     * speedup from this.
+     *
+     * @param threadBundle the threads to use
+     **/
+    void prune(vespalib::ThreadBundle &threadBundle);
+
     /**
      * Perform converting from local to global document id on all hits
      * in the underlying grouping trees.
@@ -54,6 +54,8 @@ public:
 
     AttributeInitializerResult init() const;
     uint64_t getCurrentSerialNum() const { return _currentSerialNum; }
+    const vespalib::string &getDocumentSubDbName() const { return _documentSubDbName; }
+    const AttributeSpec &getSpec() const { return _spec; }
 };
 
 } // namespace proton
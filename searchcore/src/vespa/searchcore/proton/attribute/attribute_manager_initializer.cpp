@@ -42,6 +42,10 @@ public:
             _result.add(result);
         }
     }
+
+    vespalib::string getName() const override {
+        return _initializer->getDocumentSubDbName() + ".attribute." + _initializer->getSpec().getName();
+    }
 };
 
 class AttributeManagerInitializerTask : public vespalib::Executor::Task
@@ -6,6 +6,8 @@
 #include <vespa/searchlib/attribute/attributevector.hpp>
 #include <vespa/searchlib/common/isequencedtaskexecutor.h>
 #include <vespa/document/datatype/documenttype.h>
+#include <limits>
+#include <mutex>
 
 #include <vespa/log/log.h>
 #include <vespa/document/base/exceptions.h>
@@ -56,6 +58,71 @@ AttributeWriter::WriteContext::buildFieldPaths(const DocumentType &docType)
     assert(fieldId == _fieldPaths.size());
 }
 
+bool
+AttributeWriter::WriteContext::findAttribute(const AttributeVector *attr, uint32_t &fieldId) const
+{
+    for (fieldId = 0; fieldId < _attributes.size(); ++fieldId) {
+        if (_attributes[fieldId] == attr) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * A put (all attributes of the write context) or an update of a single
+ * attribute in a write batch.
+ */
+struct AttributeWriter::WriteBatchEntry
+{
+    static constexpr uint32_t ALL_FIELDS = std::numeric_limits<uint32_t>::max();
+
+    SerialNum                   serialNum;
+    uint32_t                    lid;
+    bool                        immediateCommit;
+    uint32_t                    fieldId;
+    const FieldUpdate          *fieldUpdate;
+    std::vector<FieldValue::UP> fieldValues;
+    std::remove_reference_t<AttributeWriter::OnWriteDoneType> onWriteDone;
+
+    WriteBatchEntry(SerialNum serialNum_, uint32_t lid_, bool immediateCommit_, uint32_t fieldId_,
+                    const FieldUpdate *fieldUpdate_, AttributeWriter::OnWriteDoneType onWriteDone_)
+        : serialNum(serialNum_),
+          lid(lid_),
+          immediateCommit(immediateCommit_),
+          fieldId(fieldId_),
+          fieldUpdate(fieldUpdate_),
+          fieldValues(),
+          onWriteDone(onWriteDone_)
+    {
+    }
+    WriteBatchEntry(WriteBatchEntry &&rhs) = default;
+    WriteBatchEntry &operator=(WriteBatchEntry &&rhs) = default;
+    ~WriteBatchEntry() = default;
+    bool isPut() const { return fieldId == ALL_FIELDS; }
+};
+
+/**
+ * Puts and updates for the attributes in a write context, applied by a
+ * single task in the attribute field writer.
+ */
+class AttributeWriter::WriteBatch
+{
+    const WriteContext          &_wc;
+    std::mutex                   _lock;
+    bool                         _closed;
+    std::vector<WriteBatchEntry> _entries;
+
+    void applyToAttribute(uint32_t fieldId, const std::vector<WriteBatchEntry> &entries);
+public:
+    static constexpr size_t MAX_SIZE = 256;
+
+    WriteBatch(const WriteContext &wc);
+    ~WriteBatch();
+    bool tryAdd(WriteBatchEntry &entry);
+    void apply();
+};
+
 namespace {
 
 void
@@ -179,56 +246,6 @@ FieldContext::operator<(const FieldContext &rhs) const
     return _name < rhs._name;
 }
 
-class PutTask : public vespalib::Executor::Task
-{
-    const AttributeWriter::WriteContext  &_wc;
-    const SerialNum      _serialNum;
-    const uint32_t       _lid;
-    const bool           _immediateCommit;
-    std::remove_reference_t<AttributeWriter::OnWriteDoneType> _onWriteDone;
-    std::vector<FieldValue::UP> _fieldValues;
-public:
-    PutTask(const AttributeWriter::WriteContext &wc, SerialNum serialNum, const Document &doc, uint32_t lid, bool immediateCommit, AttributeWriter::OnWriteDoneType onWriteDone);
-    virtual ~PutTask() override;
-    virtual void run() override;
-};
-
-PutTask::PutTask(const AttributeWriter::WriteContext &wc, SerialNum serialNum, const Document &doc, uint32_t lid, bool immediateCommit, AttributeWriter::OnWriteDoneType onWriteDone)
-    : _wc(wc),
-      _serialNum(serialNum),
-      _lid(lid),
-      _immediateCommit(immediateCommit),
-      _onWriteDone(onWriteDone)
-{
-    const auto &fieldPaths = _wc.getFieldPaths();
-    _fieldValues.reserve(fieldPaths.size());
-    for (const auto &fieldPath : fieldPaths) {
-        FieldValue::UP fv;
-        if (!fieldPath.empty()) {
-            fv = doc.getNestedFieldValue(fieldPath.getFullRange());
-        }
-        _fieldValues.emplace_back(std::move(fv));
-    }
-}
-
-PutTask::~PutTask()
-{
-}
-
-void
-PutTask::run()
-{
-    uint32_t fieldId = 0;
-    const auto &attributes = _wc.getAttributes();
-    for (auto attrp : attributes) {
-        AttributeVector &attr = *attrp;
-        if (attr.getStatus().getLastSyncToken() < _serialNum) {
-            applyPutToAttribute(_serialNum, _fieldValues[fieldId], _lid, _immediateCommit, attr, _onWriteDone);
-        }
-        ++fieldId;
-    }
-}
-
 class RemoveTask : public vespalib::Executor::Task
 {
     const AttributeWriter::WriteContext  &_wc;
@@ -304,6 +321,74 @@ CommitTask::run()
 
 }
 
+AttributeWriter::WriteBatch::WriteBatch(const WriteContext &wc)
+    : _wc(wc),
+      _lock(),
+      _closed(false),
+      _entries()
+{
+}
+
+AttributeWriter::WriteBatch::~WriteBatch() = default;
+
+bool
+AttributeWriter::WriteBatch::tryAdd(WriteBatchEntry &entry)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_closed || _entries.size() >= MAX_SIZE) {
+        return false;
+    }
+    _entries.emplace_back(std::move(entry));
+    return true;
+}
+
+void
+AttributeWriter::WriteBatch::applyToAttribute(uint32_t fieldId, const std::vector<WriteBatchEntry> &entries)
+{
+    AttributeVector &attr = *_wc.getAttributes()[fieldId];
+    // Commit as late as possible, but never let a commit cover operations
+    // that were not to be committed yet.
+    SerialNum commitSerialNum = 0;
+    for (const auto &entry : entries) {
+        if (entry.isPut()) {
+            if (attr.getStatus().getLastSyncToken() >= entry.serialNum) {
+                continue;
+            }
+        } else if (entry.fieldId != fieldId) {
+            continue;
+        }
+        if (commitSerialNum != 0 && !entry.immediateCommit) {
+            attr.commit(commitSerialNum, commitSerialNum);
+            commitSerialNum = 0;
+        }
+        if (entry.isPut()) {
+            applyPutToAttribute(entry.serialNum, entry.fieldValues[fieldId], entry.lid, false, attr, entry.onWriteDone);
+        } else {
+            applyUpdateToAttribute(entry.serialNum, *entry.fieldUpdate, entry.lid, false, attr, entry.onWriteDone);
+        }
+        if (entry.immediateCommit) {
+            commitSerialNum = entry.serialNum;
+        }
+    }
+    if (commitSerialNum != 0) {
+        attr.commit(commitSerialNum, commitSerialNum);
+    }
+}
+
+void
+AttributeWriter::WriteBatch::apply()
+{
+    std::vector<WriteBatchEntry> entries;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _closed = true;
+        entries.swap(_entries);
+    }
+    for (uint32_t fieldId = 0; fieldId < _wc.getAttributes().size(); ++fieldId) {
+        applyToAttribute(fieldId, entries);
+    }
+}
+
 void
 AttributeWriter::setupWriteContexts()
 {
@@ -320,6 +405,43 @@ AttributeWriter::setupWriteContexts()
         }
         _writeContexts.back().add(fc.getAttribute());
     }
+    _writeBatches.resize(_writeContexts.size());
+}
+
+size_t
+AttributeWriter::findWriteContext(const AttributeVector &attr, uint32_t &fieldId)
+{
+    uint32_t executorId = _attributeFieldWriter.getExecutorId(attr.getName());
+    for (size_t wcIdx = 0; wcIdx < _writeContexts.size(); ++wcIdx) {
+        const auto &wc = _writeContexts[wcIdx];
+        if (wc.getExecutorId() == executorId && wc.findAttribute(&attr, fieldId)) {
+            return wcIdx;
+        }
+    }
+    return _writeContexts.size();
+}
+
+void
+AttributeWriter::addToWriteBatch(size_t wcIdx, WriteBatchEntry &&entry)
+{
+    auto &batch = _writeBatches[wcIdx];
+    if (batch && batch->tryAdd(entry)) {
+        return;
+    }
+    batch = std::make_shared<WriteBatch>(_writeContexts[wcIdx]);
+    bool added = batch->tryAdd(entry);
+    assert(added);
+    (void) added;
+    _attributeFieldWriter.executeLambda(_writeContexts[wcIdx].getExecutorId(),
+                                        [batch = batch]() { batch->apply(); });
+}
+
+void
+AttributeWriter::closeWriteBatches()
+{
+    for (auto &batch : _writeBatches) {
+        batch.reset();
+    }
 }
 
 void
@@ -335,9 +457,18 @@ void
 AttributeWriter::internalPut(SerialNum serialNum, const Document &doc, DocumentIdT lid,
                              bool immediateCommit, OnWriteDoneType onWriteDone)
 {
-    for (const auto &wc : _writeContexts) {
-        auto putTask = std::make_unique<PutTask>(wc, serialNum, doc, lid, immediateCommit, onWriteDone);
-        _attributeFieldWriter.executeTask(wc.getExecutorId(), std::move(putTask));
+    for (size_t wcIdx = 0; wcIdx < _writeContexts.size(); ++wcIdx) {
+        const auto &fieldPaths = _writeContexts[wcIdx].getFieldPaths();
+        WriteBatchEntry entry(serialNum, lid, immediateCommit, WriteBatchEntry::ALL_FIELDS, nullptr, onWriteDone);
+        entry.fieldValues.reserve(fieldPaths.size());
+        for (const auto &fieldPath : fieldPaths) {
+            FieldValue::UP fv;
+            if (!fieldPath.empty()) {
+                fv = doc.getNestedFieldValue(fieldPath.getFullRange());
+            }
+            entry.fieldValues.emplace_back(std::move(fv));
+        }
+        addToWriteBatch(wcIdx, std::move(entry));
     }
 }
 
@@ -346,6 +477,7 @@ AttributeWriter::internalRemove(SerialNum serialNum, DocumentIdT lid,
                                 bool immediateCommit,
                                 OnWriteDoneType onWriteDone)
 {
+    closeWriteBatches();
     for (const auto &wc : _writeContexts) {
         auto removeTask = std::make_unique<RemoveTask>(wc, serialNum, lid, immediateCommit, onWriteDone);
         _attributeFieldWriter.executeTask(wc.getExecutorId(), std::move(removeTask));
@@ -357,6 +489,7 @@ AttributeWriter::AttributeWriter(const proton::IAttributeManager::SP &mgr)
       _attributeFieldWriter(mgr->getAttributeFieldWriter()),
       _writableAttributes(mgr->getWritableAttributes()),
       _writeContexts(),
+      _writeBatches(),
       _dataType(nullptr)
 {
     setupWriteContexts();
@@ -440,15 +573,23 @@ AttributeWriter::update(SerialNum serialNum, const DocumentUpdate &upd, Document
 
         // NOTE: The lifetime of the field update will be ensured by keeping the document update alive
         // in a operation done context object.
-        _attributeFieldWriter.execute(attr.getName(),
-                [serialNum, &fupd, lid, immediateCommit, &attr, onWriteDone]()
-                { applyUpdateToAttribute(serialNum, fupd, lid, immediateCommit, attr, onWriteDone); });
+        uint32_t fieldId = 0;
+        size_t wcIdx = findWriteContext(attr, fieldId);
+        if (wcIdx < _writeContexts.size()) {
+            addToWriteBatch(wcIdx, WriteBatchEntry(serialNum, lid, immediateCommit, fieldId, &fupd, onWriteDone));
+        } else {
+            closeWriteBatches();
+            _attributeFieldWriter.execute(attr.getName(),
+                    [serialNum, &fupd, lid, immediateCommit, &attr, onWriteDone]()
+                    { applyUpdateToAttribute(serialNum, fupd, lid, immediateCommit, attr, onWriteDone); });
+        }
     }
 }
 
 void
 AttributeWriter::heartBeat(SerialNum serialNum)
 {
+    closeWriteBatches();
     for (auto attrp : _writableAttributes) {
         auto &attr = *attrp;
         _attributeFieldWriter.execute(attr.getName(),
@@ -461,6 +602,7 @@ AttributeWriter::heartBeat(SerialNum serialNum)
 void
 AttributeWriter::commit(SerialNum serialNum, OnWriteDoneType onWriteDone)
 {
+    closeWriteBatches();
     for (const auto &wc : _writeContexts) {
         auto commitTask = std::make_unique<CommitTask>(wc, serialNum, onWriteDone);
         _attributeFieldWriter.executeTask(wc.getExecutorId(), std::move(commitTask));
@@ -471,6 +613,7 @@ AttributeWriter::commit(SerialNum serialNum, OnWriteDoneType onWriteDone)
 void
 AttributeWriter::onReplayDone(uint32_t docIdLimit)
 {
+    closeWriteBatches();
     for (auto attrp : _writableAttributes) {
         auto &attr = *attrp;
         _attributeFieldWriter.execute(attr.getName(),
@@ -484,6 +627,7 @@ AttributeWriter::onReplayDone(uint32_t docIdLimit)
 void
 AttributeWriter::compactLidSpace(uint32_t wantedLidLimit, SerialNum serialNum)
 {
+    closeWriteBatches();
     for (auto attrp : _writableAttributes) {
         auto &attr = *attrp;
         _attributeFieldWriter.
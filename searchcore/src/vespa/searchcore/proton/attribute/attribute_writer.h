@@ -10,6 +10,14 @@ namespace proton {
 /**
  * Concrete attribute writer that handles writes in form of put, update and remove
  * to the attribute vectors managed by the underlying attribute manager.
+ *
+ * Puts and updates are added to a write batch per write context. The batch
+ * is applied by a single task in the attribute field writer, one attribute
+ * vector at a time, with one commit per attribute vector for the whole batch.
+ * A batch is open for new operations until its task starts running, so
+ * batches grow while the attribute field writer is busy and stay small when
+ * it is idle. Scheduling any other kind of task closes the open batches to
+ * preserve the order of operations.
  */
 class AttributeWriter : public IAttributeWriter
 {
@@ -36,14 +44,21 @@ public:
         void buildFieldPaths(const DocumentType &docType);
         void add(AttributeVector *attr);
         uint32_t getExecutorId() const { return _executorId; }
+        bool findAttribute(const AttributeVector *attr, uint32_t &fieldId) const;
         const std::vector<FieldPath> &getFieldPaths() const { return _fieldPaths; }
         const std::vector<AttributeVector *> &getAttributes() const { return _attributes; }
     };
+    struct WriteBatchEntry;
+    class WriteBatch;
 private:
     std::vector<WriteContext> _writeContexts;
+    std::vector<std::shared_ptr<WriteBatch>> _writeBatches; // open batch per write context
     const DataType           *_dataType;
 
     void setupWriteContexts();
+    size_t findWriteContext(const AttributeVector &attr, uint32_t &fieldId);
+    void addToWriteBatch(size_t wcIdx, WriteBatchEntry &&entry);
+    void closeWriteBatches();
     void buildFieldPaths(const DocumentType &docType, const DataType *dataType);
     void internalPut(SerialNum serialNum, const Document &doc, DocumentIdT lid,
                      bool immediateCommit, OnWriteDoneType onWriteDone);
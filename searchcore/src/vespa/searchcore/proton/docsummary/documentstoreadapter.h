@@ -49,6 +49,7 @@ public:
 
     uint32_t getNumDocs() const override { return _docStore.getDocIdLimit(); }
     search::docsummary::DocsumStoreValue getMappedDocsum(uint32_t docId) override;
+    void prefetch(const std::vector<uint32_t> &docIds) override { _docStore.prefetch(docIds); }
     uint32_t getSummaryClassId() const override { return _resultClass->GetClassID(); }
 
 };
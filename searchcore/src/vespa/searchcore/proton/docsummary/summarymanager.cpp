@@ -175,7 +175,9 @@ deriveCompression(const T & config) {
 DocumentStore::Config
 getStoreConfig(const ProtonConfig::Summary::Cache & cache)
 {
-    return DocumentStore::Config(deriveCompression(cache.compression), cache.maxbytes, cache.initialentries).allowVisitCaching(cache.allowvisitcaching);
+    return DocumentStore::Config(deriveCompression(cache.compression), cache.maxbytes, cache.initialentries)
+            .allowVisitCaching(cache.allowvisitcaching)
+            .cacheProbationPercent(std::max(0, cache.probationpercent));
 }
 
 }
@@ -204,6 +206,7 @@ SummaryManager::SummaryManager(vespalib::ThreadExecutor & executor,
                                    log.minfilesizefactor, log.numthreads, log.compact2activefile,
                                    deriveCompression(log.compact.compression), fileConfig);
     logConfig.disableCrcOnRead(chunk.skipcrconread);
+    logConfig.setCompressionDictionarySize(chunk.compression.dictionarysize);
     _docStore.reset(new LogDocumentStore(executor, baseDir,
                                          LogDocumentStore::Config(config, logConfig),
                                          growStrategy, tuneFileSummary, fileHeaderContext, tlSyncer,
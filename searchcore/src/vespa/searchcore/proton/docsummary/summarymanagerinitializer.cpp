@@ -54,5 +54,11 @@ SummaryManagerInitializer::run()
     EventLogger::loadDocumentStoreComplete(_subDbName, elapsedTimeMs);
 }
 
+vespalib::string
+SummaryManagerInitializer::getName() const
+{
+    return _subDbName + ".summary";
+}
+
 
 } // namespace proton
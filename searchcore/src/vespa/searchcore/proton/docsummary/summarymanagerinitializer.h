@@ -45,6 +45,7 @@ public:
                               IBucketizerSP bucketizer,
                               std::shared_ptr<SummaryManager::SP> result);
     void run() override;
+    vespalib::string getName() const override;
 };
 
 } // namespace proton
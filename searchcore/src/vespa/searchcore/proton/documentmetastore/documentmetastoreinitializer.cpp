@@ -61,6 +61,12 @@ DocumentMetaStoreInitializer::run()
     }
 }
 
+vespalib::string
+DocumentMetaStoreInitializer::getName() const
+{
+    return _subDbName + ".documentmetastore";
+}
+
 
 } // namespace proton::documentmetastore
 
@@ -10,9 +10,13 @@ namespace proton {
 
 IndexManagerInitializer::
 IndexManagerInitializer(const vespalib::string &baseDir,
+                        const vespalib::string &subDbName,
                         const searchcorespi::index::WarmupConfig & warmupCfg,
                         size_t maxFlushed,
                         size_t cacheSize,
+                        uint32_t numFieldPartitions,
+                        uint32_t bulkLoadDocs,
+                        uint32_t fusionThreads,
                         const search::index::Schema &schema,
                         search::SerialNum serialNum,
                         searchcorespi::IIndexManager::Reconfigurer & reconfigurer,
@@ -23,9 +27,13 @@ IndexManagerInitializer(const vespalib::string &baseDir,
                         const search::common::FileHeaderContext & fileHeaderContext,
                         std::shared_ptr<searchcorespi::IIndexManager::SP> indexManager)
     : _baseDir(baseDir),
+      _subDbName(subDbName),
       _warmupCfg(warmupCfg),
       _maxFlushed(maxFlushed),
       _cacheSize(cacheSize),
+      _numFieldPartitions(numFieldPartitions),
+      _bulkLoadDocs(bulkLoadDocs),
+      _fusionThreads(fusionThreads),
       _schema(schema),
       _serialNum(serialNum),
       _reconfigurer(reconfigurer),
@@ -50,6 +58,9 @@ IndexManagerInitializer::run()
                      _warmupCfg,
                      _maxFlushed,
                      _cacheSize,
+                     _numFieldPartitions,
+                     _bulkLoadDocs,
+                     _fusionThreads,
                      _schema,
                      _serialNum,
                      _reconfigurer,
@@ -60,5 +71,11 @@ IndexManagerInitializer::run()
                      _fileHeaderContext);
 }
 
+vespalib::string
+IndexManagerInitializer::getName() const
+{
+    return _subDbName + ".index";
+}
+
 
 } // namespace proton
@@ -16,9 +16,13 @@ namespace proton
 class IndexManagerInitializer :  public initializer::InitializerTask
 {
     const vespalib::string                      _baseDir;
+    const vespalib::string                      _subDbName;
     const searchcorespi::index::WarmupConfig    _warmupCfg;
     size_t                                      _maxFlushed;
     size_t                                      _cacheSize;
+    uint32_t                                    _numFieldPartitions;
+    uint32_t                                    _bulkLoadDocs;
+    uint32_t                                    _fusionThreads;
     const search::index::Schema                 _schema;
     search::SerialNum                           _serialNum;
     searchcorespi::IIndexManager::Reconfigurer &_reconfigurer;
@@ -31,9 +35,13 @@ class IndexManagerInitializer :  public initializer::InitializerTask
 public:
     // Note: lifetime of indexManager must be handled by caller.
     IndexManagerInitializer(const vespalib::string &baseDir,
+                            const vespalib::string &subDbName,
                             const searchcorespi::index::WarmupConfig & warmupCfg,
                             size_t maxFlushed,
                             size_t cacheSize,
+                            uint32_t numFieldPartitions,
+                            uint32_t bulkLoadDocs,
+                            uint32_t fusionThreads,
                             const search::index::Schema &schema,
                             search::SerialNum serialNum,
                             searchcorespi::IIndexManager::Reconfigurer & reconfigurer,
@@ -44,6 +52,7 @@ public:
                             const search::common::FileHeaderContext & fileHeaderContext,
                             std::shared_ptr<searchcorespi::IIndexManager::SP> indexManager);
     virtual void run() override;
+    virtual vespalib::string getName() const override;
 };
 
 } // namespace proton
@@ -27,10 +27,14 @@ namespace proton {
 IndexManager::MaintainerOperations::MaintainerOperations(const FileHeaderContext &fileHeaderContext,
                                                          const TuneFileIndexManager &tuneFileIndexManager,
                                                          size_t cacheSize,
+                                                         uint32_t numFieldPartitions,
+                                                         uint32_t fusionThreads,
                                                          searchcorespi::index::
                                                          IThreadingService &
                                                          threadingService)
     : _cacheSize(cacheSize),
+      _numFieldPartitions(numFieldPartitions),
+      _fusionThreads(fusionThreads),
       _fileHeaderContext(fileHeaderContext),
       _tuneFileIndexing(tuneFileIndexManager._indexing),
       _tuneFileSearch(tuneFileIndexManager._search),
@@ -46,6 +50,7 @@ IndexManager::MaintainerOperations::createMemoryIndex(const Schema &schema,
                                                    _fileHeaderContext,
                                                    _tuneFileIndexing,
                                                    _threadingService,
+                                                   _numFieldPartitions,
                                                    serialNum));
 }
 
@@ -74,7 +79,8 @@ IndexManager::MaintainerOperations::runFusion(const Schema &schema,
     const bool dynamic_k_doc_pos_occ_format = false;
     return Fusion::merge(schema, outputDir, sources, selectorArray,
                          dynamic_k_doc_pos_occ_format,
-                         _tuneFileIndexing, fileHeaderContext);
+                         _tuneFileIndexing, fileHeaderContext,
+                         _fusionThreads);
 }
 
 
@@ -82,6 +88,9 @@ IndexManager::IndexManager(const vespalib::string &baseDir,
                            const WarmupConfig & warmup,
                            const size_t maxFlushed,
                            const size_t cacheSize,
+                           const uint32_t numFieldPartitions,
+                           const uint32_t bulkLoadDocs,
+                           const uint32_t fusionThreads,
                            const Schema &schema,
                            SerialNum serialNum,
                            Reconfigurer &reconfigurer,
@@ -91,13 +100,14 @@ IndexManager::IndexManager(const vespalib::string &baseDir,
                            const search::TuneFileAttributes &tuneFileAttributes,
                            const search::common::FileHeaderContext &fileHeaderContext) :
     _operations(fileHeaderContext, tuneFileIndexManager, cacheSize,
-                threadingService),
+                numFieldPartitions, fusionThreads, threadingService),
     _maintainer(IndexMaintainerConfig(baseDir,
                                       warmup,
                                       maxFlushed,
                                       schema,
                                       serialNum,
-                                      tuneFileAttributes),
+                                      tuneFileAttributes,
+                                      bulkLoadDocs),
                 IndexMaintainerContext(threadingService,
                                        reconfigurer,
                                        fileHeaderContext,
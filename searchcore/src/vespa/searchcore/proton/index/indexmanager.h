@@ -20,6 +20,8 @@ public:
     class MaintainerOperations : public searchcorespi::index::IIndexMaintainerOperations {
     private:
         const size_t _cacheSize;
+        const uint32_t _numFieldPartitions;
+        const uint32_t _fusionThreads;
         const search::common::FileHeaderContext &_fileHeaderContext;
         const search::TuneFileIndexing _tuneFileIndexing;
         const search::TuneFileSearch _tuneFileSearch;
@@ -29,6 +31,8 @@ public:
         MaintainerOperations(const search::common::FileHeaderContext &fileHeaderContext,
                              const search::TuneFileIndexManager &tuneFileIndexManager,
                              size_t cacheSize,
+                             uint32_t numFieldPartitions,
+                             uint32_t fusionThreads,
                              searchcorespi::index::IThreadingService &
                              threadingService);
 
@@ -57,6 +61,9 @@ public:
                  const searchcorespi::index::WarmupConfig & warmup,
                  size_t maxFlushed,
                  size_t cacheSize,
+                 uint32_t numFieldPartitions,
+                 uint32_t bulkLoadDocs,
+                 uint32_t fusionThreads,
                  const Schema &schema,
                  SerialNum serialNum,
                  Reconfigurer &reconfigurer,
@@ -115,6 +122,14 @@ public:
     virtual void setSchema(const Schema &schema, SerialNum serialNum) override {
         _maintainer.setSchema(schema, serialNum);
     }
+
+    virtual void setBulkLoad(uint32_t bulkLoadDocs) override {
+        _maintainer.setBulkLoad(bulkLoadDocs);
+    }
+
+    virtual double getFusionThroughput() const override {
+        return _maintainer.getFusionThroughput();
+    }
 };
 
 } // namespace proton
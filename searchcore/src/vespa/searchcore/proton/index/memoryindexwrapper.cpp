@@ -21,9 +21,10 @@ MemoryIndexWrapper::MemoryIndexWrapper(const search::index::Schema &schema,
                                        const TuneFileIndexing &tuneFileIndexing,
                                        searchcorespi::index::IThreadingService &
                                        threadingService,
+                                       uint32_t numFieldPartitions,
                                        search::SerialNum serialNum)
     : _index(schema, threadingService.indexFieldInverter(),
-             threadingService.indexFieldWriter()),
+             threadingService.indexFieldWriter(), numFieldPartitions),
       _serialNum(serialNum),
       _fileHeaderContext(fileHeaderContext),
       _tuneFileIndexing(tuneFileIndexing)
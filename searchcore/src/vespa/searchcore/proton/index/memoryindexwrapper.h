@@ -29,6 +29,7 @@ public:
                        const search::TuneFileIndexing &tuneFileIndexing,
                        searchcorespi::index::IThreadingService &
                        threadingService,
+                       uint32_t numFieldPartitions,
                        SerialNum serialNum);
 
     /**
@@ -84,6 +85,9 @@ public:
         _index.commit(onWriteDone);
         _serialNum.store(serialNum, std::memory_order_relaxed);
     }
+    void setBulkLoad(uint32_t bulkLoadDocs) override {
+        _index.setBulkLoad(bulkLoadDocs);
+    }
     void pruneRemovedFields(const search::index::Schema &schema)  override {
         _index.pruneRemovedFields(schema);
     }
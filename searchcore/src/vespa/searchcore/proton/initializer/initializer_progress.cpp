@@ -0,0 +1,55 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "initializer_progress.h"
+#include <cassert>
+
+namespace proton::initializer {
+
+std::chrono::milliseconds
+InitializerProgress::TaskInfo::elapsed(Clock::time_point now) const
+{
+    Clock::time_point end = (state == State::DONE) ? endTime : now;
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - startTime);
+}
+
+
+InitializerProgress::InitializerProgress()
+    : _lock(),
+      _tasks()
+{
+}
+
+
+InitializerProgress::~InitializerProgress()
+{
+}
+
+
+size_t
+InitializerProgress::taskStarted(const vespalib::string &name)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _tasks.emplace_back(name, Clock::now());
+    return _tasks.size() - 1;
+}
+
+
+void
+InitializerProgress::taskDone(size_t id)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    assert(id < _tasks.size());
+    TaskInfo &task = _tasks[id];
+    task.state = State::DONE;
+    task.endTime = Clock::now();
+}
+
+
+std::vector<InitializerProgress::TaskInfo>
+InitializerProgress::getTasks() const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _tasks;
+}
+
+} // namespace proton::initializer
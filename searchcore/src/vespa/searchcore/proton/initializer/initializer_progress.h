@@ -0,0 +1,55 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#pragma once
+
+#include "initializer_task.h"
+#include <chrono>
+#include <mutex>
+
+namespace proton {
+
+namespace initializer {
+
+/*
+ * Class tracking state and load time of named initializer tasks run
+ * by a task runner. Updated by the task runner context executor and
+ * read by the state explorer, thus all access is protected by a lock.
+ */
+class InitializerProgress {
+public:
+    using SP = std::shared_ptr<InitializerProgress>;
+    using Clock = std::chrono::steady_clock;
+    using State = InitializerTask::State;
+
+    struct TaskInfo {
+        vespalib::string  name;
+        State             state;
+        Clock::time_point startTime;
+        Clock::time_point endTime;
+
+        TaskInfo(const vespalib::string &name_, Clock::time_point startTime_)
+            : name(name_),
+              state(State::RUNNING),
+              startTime(startTime_),
+              endTime(startTime_)
+        {
+        }
+        // Load time for done tasks, time spent so far for running tasks.
+        std::chrono::milliseconds elapsed(Clock::time_point now) const;
+    };
+
+private:
+    mutable std::mutex    _lock;
+    std::vector<TaskInfo> _tasks;
+
+public:
+    InitializerProgress();
+    ~InitializerProgress();
+    // Returns id to be used when marking task as done.
+    size_t taskStarted(const vespalib::string &name);
+    void taskDone(size_t id);
+    std::vector<TaskInfo> getTasks() const;
+};
+
+} // namespace proton::initializer
+
+} // namespace proton
@@ -22,5 +22,12 @@ InitializerTask::addDependency(SP dependency)
     _dependencies.emplace_back(std::move(dependency));
 }
 
+
+vespalib::string
+InitializerTask::getName() const
+{
+    return vespalib::string();
+}
+
 } // namespace proton::initializer
 
@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 #pragma once
 
+#include <vespa/vespalib/stllike/string.h>
 #include <memory>
 #include <vector>
 
@@ -33,6 +34,12 @@ public:
     void setDone() { _state = State::DONE; }
     void addDependency(SP dependency);
     virtual void run() = 0;
+    /*
+     * Name used when reporting initializer progress. Tasks with an
+     * empty name (e.g. tasks only grouping other tasks) are not
+     * reported.
+     */
+    virtual vespalib::string getName() const;
 };
 
 } // namespace proton::initializer
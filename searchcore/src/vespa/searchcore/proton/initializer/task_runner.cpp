@@ -11,9 +11,13 @@ namespace proton {
 
 namespace initializer {
 
-TaskRunner::TaskRunner(vespalib::Executor &executor)
+TaskRunner::TaskRunner(vespalib::Executor &executor,
+                       uint32_t maxConcurrentTasks,
+                       InitializerProgress::SP progress)
     : _executor(executor),
-      _runningTasks(0u)
+      _runningTasks(0u),
+      _maxConcurrentTasks(maxConcurrentTasks),
+      _progress(std::move(progress))
 {
 }
 
@@ -59,10 +63,13 @@ TaskRunner::setTaskRunning(InitializerTask &task)
 }
 
 void
-TaskRunner::setTaskDone(InitializerTask &task, Context::SP context)
+TaskRunner::setTaskDone(InitializerTask &task, size_t progressId, Context::SP context)
 {
     // run by context executor
     task.setDone();
+    if (progressId != NO_PROGRESS_ID) {
+        _progress->taskDone(progressId);
+    }
     --_runningTasks;
     pollTask(context);
 }
@@ -73,7 +80,14 @@ TaskRunner::internalRunTask(InitializerTask::SP task, Context::SP context)
     // run by context executor
     assert(task->getState() == State::BLOCKED);
     setTaskRunning(*task);
-    auto done(makeLambdaTask([=]() { setTaskDone(*task, context); }));
+    size_t progressId = NO_PROGRESS_ID;
+    if (_progress) {
+        vespalib::string name = task->getName();
+        if (!name.empty()) {
+            progressId = _progress->taskStarted(name);
+        }
+    }
+    auto done(makeLambdaTask([=]() { setTaskDone(*task, progressId, context); }));
     _executor.execute(makeLambdaTask([=, done(std::move(done))]() mutable
                                      {   task->run();
                                          context->execute(std::move(done)); }));
@@ -84,6 +98,9 @@ TaskRunner::internalRunTasks(const TaskList &taskList, Context::SP context)
 {
     // run by context executor
     for (auto &task : taskList) {
+        if (_maxConcurrentTasks != 0u && _runningTasks >= _maxConcurrentTasks) {
+            break; // remaining ready tasks are started when running tasks are done
+        }
         internalRunTask(task, context);
     }
 }
@@ -1,10 +1,12 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 #pragma once
 
+#include "initializer_progress.h"
 #include "initializer_task.h"
 #include <vespa/vespalib/util/executor.h>
 #include <vespa/vespalib/stllike/hash_set.h>
 #include <cassert>
+#include <limits>
 
 namespace proton {
 
@@ -17,6 +19,8 @@ class TaskRunner {
     // Executor for the tasks, not to be confused by the context executor.
     vespalib::Executor      &_executor;     // can be multithreaded
     uint32_t                 _runningTasks; // used by context executor
+    uint32_t                 _maxConcurrentTasks; // 0 means no limit
+    InitializerProgress::SP  _progress;     // can be empty
     using State = InitializerTask::State;
     using TaskList = InitializerTask::List;
     using TaskSet = vespalib::hash_set<const void *>;
@@ -49,7 +53,7 @@ class TaskRunner {
 
     void setTaskRunning(InitializerTask &task);
 
-    void setTaskDone(InitializerTask &task, Context::SP context);
+    void setTaskDone(InitializerTask &task, size_t progressId, Context::SP context);
 
     void internalRunTask(InitializerTask::SP task, Context::SP context);
 
@@ -57,7 +61,17 @@ class TaskRunner {
 
     void pollTask(Context::SP context);
 public:
-    TaskRunner(vespalib::Executor &executor);
+    static constexpr size_t NO_PROGRESS_ID = std::numeric_limits<size_t>::max();
+
+    /*
+     * maxConcurrentTasks limits the number of tasks running at the
+     * same time, to avoid too much disk I/O contention when loading
+     * many data structures. 0 means no limit. Start and end of named
+     * tasks are recorded in progress, if present.
+     */
+    TaskRunner(vespalib::Executor &executor,
+               uint32_t maxConcurrentTasks = 0,
+               InitializerProgress::SP progress = InitializerProgress::SP());
 
     virtual ~TaskRunner();
 
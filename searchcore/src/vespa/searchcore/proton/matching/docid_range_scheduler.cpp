@@ -160,5 +160,104 @@ AdaptiveDocidRangeScheduler::share_range(size_t thread_id, DocidRange todo)
 
 //-----------------------------------------------------------------------------
 
+DocidRange
+WorkStealingDocidRangeScheduler::take_own(size_t thread_id)
+{
+    std::atomic<uint64_t> &chunks = _workers[thread_id].chunks;
+    uint64_t old_chunks = chunks.load(std::memory_order_acquire);
+    while (num_chunks(old_chunks) > 0) {
+        uint64_t new_chunks = pack(first_chunk(old_chunks) + 1, end_chunk(old_chunks));
+        if (chunks.compare_exchange_weak(old_chunks, new_chunks, std::memory_order_acq_rel)) {
+            return assign(thread_id, _splitter.get(first_chunk(old_chunks)));
+        }
+    }
+    return DocidRange();
+}
+
+DocidRange
+WorkStealingDocidRangeScheduler::steal(size_t thread_id, size_t victim)
+{
+    std::atomic<uint64_t> &chunks = _workers[victim].chunks;
+    uint64_t old_chunks = chunks.load(std::memory_order_acquire);
+    while (num_chunks(old_chunks) > 0) {
+        uint32_t stolen = (num_chunks(old_chunks) + 1) / 2;
+        uint32_t split = end_chunk(old_chunks) - stolen;
+        uint64_t new_chunks = pack(first_chunk(old_chunks), split);
+        if (chunks.compare_exchange_weak(old_chunks, new_chunks, std::memory_order_acq_rel)) {
+            // our own chunks are exhausted, so nobody can steal from them concurrently
+            _workers[thread_id].chunks.store(pack(split + 1, end_chunk(old_chunks)), std::memory_order_release);
+            return assign(thread_id, _splitter.get(split));
+        }
+    }
+    return DocidRange();
+}
+
+DocidRange
+WorkStealingDocidRangeScheduler::assign(size_t thread_id, DocidRange range)
+{
+    _workers[thread_id].assigned += range.size();
+    return range;
+}
+
+WorkStealingDocidRangeScheduler::WorkStealingDocidRangeScheduler(size_t num_threads, size_t chunks_per_thread,
+                                                                 size_t num_nodes, uint32_t docid_limit)
+    : _splitter(DocidRange(1, docid_limit), num_threads * std::max(size_t(1), chunks_per_thread)),
+      _workers(num_threads)
+{
+    size_t per_thread = std::max(size_t(1), chunks_per_thread);
+    num_nodes = std::max(size_t(1), std::min(num_nodes, num_threads));
+    auto node_of = [num_threads,num_nodes](size_t thread_id){ return (thread_id * num_nodes) / num_threads; };
+    for (size_t i = 0; i < num_threads; ++i) {
+        _workers[i].chunks.store(pack(i * per_thread, (i + 1) * per_thread), std::memory_order_relaxed);
+        // victims in our own node first, then the rest; both in round-robin order after ourselves
+        std::vector<size_t> &victims = _workers[i].victims;
+        for (size_t j = 1; j < num_threads; ++j) {
+            size_t victim = (i + j) % num_threads;
+            if (node_of(victim) == node_of(i)) {
+                victims.push_back(victim);
+            }
+        }
+        for (size_t j = 1; j < num_threads; ++j) {
+            size_t victim = (i + j) % num_threads;
+            if (node_of(victim) != node_of(i)) {
+                victims.push_back(victim);
+            }
+        }
+    }
+}
+
+WorkStealingDocidRangeScheduler::~WorkStealingDocidRangeScheduler() {}
+
+DocidRange
+WorkStealingDocidRangeScheduler::next_range(size_t thread_id)
+{
+    DocidRange range = take_own(thread_id);
+    if (!range.empty()) {
+        return range;
+    }
+    for (size_t victim: _workers[thread_id].victims) {
+        range = steal(thread_id, victim);
+        if (!range.empty()) {
+            return range;
+        }
+    }
+    return DocidRange();
+}
+
+size_t
+WorkStealingDocidRangeScheduler::unassigned_size() const
+{
+    size_t sum = 0;
+    for (const Worker &worker: _workers) {
+        uint64_t chunks = worker.chunks.load(std::memory_order_relaxed);
+        if (num_chunks(chunks) > 0) {
+            sum += (_splitter.get(end_chunk(chunks) - 1).end - _splitter.get(first_chunk(chunks)).begin);
+        }
+    }
+    return sum;
+}
+
+//-----------------------------------------------------------------------------
+
 } // namespace proton::matching
 } // namespace proton
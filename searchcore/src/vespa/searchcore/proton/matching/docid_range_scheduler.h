@@ -205,5 +205,52 @@ public:
     DocidRange share_range(size_t, DocidRange todo) override;
 };
 
+/**
+ * A lock-free work-stealing scheduler. The docid space is split into
+ * many small chunks of equal size, and each thread starts out owning a
+ * consecutive sequence of chunks. A thread processes its own chunks in
+ * increasing docid order. When it runs out, it steals the upper half
+ * of the remaining chunks from another thread, takes the first stolen
+ * chunk as its next range and keeps the rest as its own.
+ *
+ * Threads may be grouped into nodes (e.g. NUMA nodes). A thread out of
+ * work will try to steal from threads in its own node before it tries
+ * threads in other nodes. Threads are assigned to nodes in consecutive
+ * blocks, matching the initial assignment of docid chunks.
+ **/
+class WorkStealingDocidRangeScheduler : public DocidRangeScheduler
+{
+private:
+    // [first, end) chunk indexes packed into a single word to allow lock-free updates
+    struct alignas(64) Worker {
+        std::atomic<uint64_t> chunks;
+        size_t                assigned;
+        std::vector<size_t>   victims;
+        Worker() : chunks(0), assigned(0), victims() {}
+        Worker(const Worker &rhs) : chunks(rhs.chunks.load()), assigned(rhs.assigned), victims(rhs.victims) {}
+    };
+    static uint64_t pack(uint32_t first, uint32_t end) { return ((uint64_t(first) << 32) | end); }
+    static uint32_t first_chunk(uint64_t chunks) { return (chunks >> 32); }
+    static uint32_t end_chunk(uint64_t chunks) { return (chunks & 0xffffffff); }
+    static uint32_t num_chunks(uint64_t chunks) { return (end_chunk(chunks) - first_chunk(chunks)); }
+
+    DocidRangeSplitter  _splitter;
+    std::vector<Worker> _workers;
+
+    VESPA_DLL_LOCAL DocidRange take_own(size_t thread_id);
+    VESPA_DLL_LOCAL DocidRange steal(size_t thread_id, size_t victim);
+    VESPA_DLL_LOCAL DocidRange assign(size_t thread_id, DocidRange range);
+public:
+    WorkStealingDocidRangeScheduler(size_t num_threads, size_t chunks_per_thread, size_t num_nodes, uint32_t docid_limit);
+    ~WorkStealingDocidRangeScheduler();
+    DocidRange first_range(size_t thread_id) override { return next_range(thread_id); }
+    DocidRange next_range(size_t thread_id) override;
+    DocidRange total_span(size_t) const override { return _splitter.full_range(); }
+    size_t total_size(size_t thread_id) const override { return _workers[thread_id].assigned; }
+    size_t unassigned_size() const override;
+    IdleObserver make_idle_observer() const override { return IdleObserver(); }
+    DocidRange share_range(size_t, DocidRange todo) override { return todo; }
+};
+
 } // namespace proton::matching
 } // namespace proton
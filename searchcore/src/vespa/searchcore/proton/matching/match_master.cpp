@@ -39,8 +39,13 @@ struct TimedMatchLoopCommunicator : IMatchLoopCommunicator {
 };
 
 DocidRangeScheduler::UP
-createScheduler(uint32_t numThreads, uint32_t numSearchPartitions, uint32_t numDocs)
+createScheduler(uint32_t numThreads, uint32_t numSearchPartitions, uint32_t workStealingChunksPerThread,
+                uint32_t workStealingNumNodes, uint32_t numDocs)
 {
+    if ((workStealingChunksPerThread > 0) && (numThreads > 1)) {
+        return std::make_unique<WorkStealingDocidRangeScheduler>(numThreads, workStealingChunksPerThread,
+                                                                 workStealingNumNodes, numDocs);
+    }
     if (numSearchPartitions == 0) {
         return std::make_unique<AdaptiveDocidRangeScheduler>(numThreads, 1, numDocs);
     }
@@ -58,14 +63,18 @@ MatchMaster::match(const MatchParams &params,
                    const MatchToolsFactory &matchToolsFactory,
                    ResultProcessor &resultProcessor,
                    uint32_t distributionKey,
-                   uint32_t numSearchPartitions)
+                   uint32_t numSearchPartitions,
+                   uint32_t workStealingChunksPerThread,
+                   uint32_t workStealingNumNodes)
 {
     fastos::StopWatch query_latency_time;
     query_latency_time.start();
     vespalib::DualMergeDirector mergeDirector(threadBundle.size());
     MatchLoopCommunicator communicator(threadBundle.size(), params.heapSize);
     TimedMatchLoopCommunicator timedCommunicator(communicator);
-    DocidRangeScheduler::UP scheduler = createScheduler(threadBundle.size(), numSearchPartitions, params.numDocs);
+    DocidRangeScheduler::UP scheduler = createScheduler(threadBundle.size(), numSearchPartitions,
+                                                        workStealingChunksPerThread, workStealingNumNodes,
+                                                        params.numDocs);
 
     std::vector<MatchThread::UP> threadState;
     std::vector<vespalib::Runnable*> targets;
@@ -81,7 +90,7 @@ MatchMaster::match(const MatchParams &params,
     }
     resultProcessor.prepareThreadContextCreation(threadBundle.size());
     threadBundle.run(targets);
-    ResultProcessor::Result::UP reply = resultProcessor.makeReply(threadState[0]->extract_result());
+    ResultProcessor::Result::UP reply = resultProcessor.makeReply(threadState[0]->extract_result(), threadBundle);
     query_latency_time.stop();
     double query_time_s = query_latency_time.elapsed().sec();
     double rerank_time_s = timedCommunicator.rerank_time.elapsed().sec();
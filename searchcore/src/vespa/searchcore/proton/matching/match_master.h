@@ -29,7 +29,9 @@ public:
                                       const MatchToolsFactory &matchToolsFactory,
                                       ResultProcessor &resultProcessor,
                                       uint32_t distributionKey,
-                                      uint32_t numSearchPartitions);
+                                      uint32_t numSearchPartitions,
+                                      uint32_t workStealingChunksPerThread,
+                                      uint32_t workStealingNumNodes);
 
     static std::shared_ptr<search::FeatureSet>
     getFeatureSet(const MatchToolsFactory &matchToolsFactory,
@@ -91,15 +91,29 @@ MatchThread::Context::Context(double rankDropLimit, MatchTools & matchTools, Ran
     _matches_limit(matchTools.match_limiter().sample_hits_per_thread(num_threads)),
     _score_feature(get_score_feature(ranking)),
     _ranking(ranking),
+    _use_batch(ranking.prepare_batch()),
+    _batch(),
     _rankDropLimit(rankDropLimit),
     _hits(hits),
     _softDoom(matchTools.getSoftDoom()),
     _limiter(matchTools.match_limiter())
-{ }
+{
+    if (_use_batch) {
+        _batch.reserve(RankProgram::BATCH_SIZE);
+    }
+}
 
 void
-MatchThread::Context::rankHit(uint32_t docId) {
-    double score = _score_feature.as_number(docId);
+MatchThread::Context::rankBatch() {
+    vespalib::ConstArrayRef<search::feature_t> scores = _ranking.execute_batch(_batch);
+    for (size_t i = 0; i < _batch.size(); ++i) {
+        addScoredHit(_batch[i], scores[i]);
+    }
+    _batch.clear();
+}
+
+void
+MatchThread::Context::addScoredHit(uint32_t docId, double score) {
     // convert NaN and Inf scores to -Inf
     if (__builtin_expect(std::isnan(score) || std::isinf(score), false)) {
         score = -HUGE_VAL;
@@ -196,6 +210,9 @@ MatchThread::match_loop(MatchTools &matchTools, IteratorT search,
     {
         softDoomed = inner_match_loop<IteratorT, do_rank, do_limit, do_share_work>(context, search, docid_range);
     }
+    if (do_rank) {
+        context.flush();
+    }
     uint32_t matches = context.matches;
     if (do_limit && context.isBelowLimit()) {
         const size_t searchedSoFar = scheduler.total_size(thread_id);
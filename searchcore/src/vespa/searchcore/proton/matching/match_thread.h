@@ -53,7 +53,21 @@ private:
     public:
         Context(double rankDropLimit, MatchTools &matchTools, RankProgram & ranking, HitCollector & hits,
                 uint32_t num_threads) __attribute__((noinline));
-        void rankHit(uint32_t docId);
+        void rankHit(uint32_t docId) {
+            if (_use_batch) {
+                _batch.push_back(docId);
+                if (_batch.size() == RankProgram::BATCH_SIZE) {
+                    rankBatch();
+                }
+            } else {
+                addScoredHit(docId, _score_feature.as_number(docId));
+            }
+        }
+        void flush() {
+            if (!_batch.empty()) {
+                rankBatch();
+            }
+        }
         void addHit(uint32_t docId) { _hits.addHit(docId, 0.0); }
         bool isBelowLimit() const { return matches < _matches_limit; }
         bool    isAtLimit() const { return matches == _matches_limit; }
@@ -61,9 +75,13 @@ private:
         MaybeMatchPhaseLimiter & limiter() { return _limiter; }
         uint32_t                  matches;
     private:
+        void addScoredHit(uint32_t docId, double score);
+        void rankBatch() __attribute__((noinline));
         uint32_t                  _matches_limit;
         LazyValue                 _score_feature;
         RankProgram             & _ranking;
+        bool                      _use_batch;
+        std::vector<uint32_t>     _batch;
         double                    _rankDropLimit;
         HitCollector            & _hits;
         const Doom              & _softDoom;
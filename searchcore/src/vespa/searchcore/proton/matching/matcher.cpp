@@ -264,8 +264,13 @@ Matcher::match(const SearchRequest &request,
         MatchMaster master;
         uint32_t numSearchPartitions = NumSearchPartitions::lookup(rankProperties,
                                                                    _rankSetup->getNumSearchPartitions());
+        uint32_t workStealingChunksPerThread =
+            WorkStealingChunksPerThread::lookup(rankProperties, _rankSetup->getWorkStealingChunksPerThread());
+        uint32_t workStealingNumNodes =
+            WorkStealingNumNodes::lookup(rankProperties, _rankSetup->getWorkStealingNumNodes());
         ResultProcessor::Result::UP result = master.match(params, limitedThreadBundle, *mtf, rp,
-                                                          _distributionKey, numSearchPartitions);
+                                                          _distributionKey, numSearchPartitions,
+                                                          workStealingChunksPerThread, workStealingNumNodes);
         my_stats = MatchMaster::getStats(std::move(master));
         size_t estimate = std::min(static_cast<size_t>(metaStore.getCommittedDocIdLimit()),
                                    mtf->match_limiter().getDocIdSpaceEstimate());
@@ -102,7 +102,7 @@ ResultProcessor::createThreadContext(const vespalib::Doom & hardDoom, size_t thr
 }
 
 ResultProcessor::Result::UP
-ResultProcessor::makeReply(PartialResultUP full_result)
+ResultProcessor::makeReply(PartialResultUP full_result, vespalib::ThreadBundle &threadBundle)
 {
     search::engine::SearchReply::UP reply(new search::engine::SearchReply());
     const search::IDocumentMetaStore &metaStore = _metaStore;
@@ -111,7 +111,7 @@ ResultProcessor::makeReply(PartialResultUP full_result)
     size_t numFs4Hits(0);
     if (_groupingSession) {
         if (_wasMerged) {
-            _groupingSession->getGroupingManager().prune();
+            _groupingSession->getGroupingManager().prune(threadBundle);
         }
         _groupingSession->getGroupingManager().convertToGlobalId(metaStore);
         _groupingSession->continueExecution(_groupingContext);
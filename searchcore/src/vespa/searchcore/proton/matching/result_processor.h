@@ -16,6 +16,8 @@ namespace search {
     class IDocumentMetaStore;
 }
 
+namespace vespalib { struct ThreadBundle; }
+
 namespace proton {
 namespace matching {
 
@@ -104,7 +106,7 @@ public:
     size_t countFS4Hits();
     void prepareThreadContextCreation(size_t num_threads);
     Context::UP createThreadContext(const vespalib::Doom & hardDoom, size_t thread_id, uint32_t distributionKey);
-    std::unique_ptr<Result> makeReply(PartialResultUP full_result);
+    std::unique_ptr<Result> makeReply(PartialResultUP full_result, vespalib::ThreadBundle &threadBundle);
 };
 
 } // namespace proton::matching
@@ -79,7 +79,8 @@ DocumentDBTaggedMetrics::AttributeMetrics::ResourceUsageMetrics::~ResourceUsageM
 
 DocumentDBTaggedMetrics::IndexMetrics::IndexMetrics(MetricSet *parent)
     : MetricSet("index", "", "Index metrics (memory and disk) for this document db", parent),
-      memoryUsage(this)
+      memoryUsage(this),
+      fusionThroughput("fusion_throughput", "", "Bytes of disk index written per second by the last fusion", this)
 { }
 
 DocumentDBTaggedMetrics::IndexMetrics::~IndexMetrics() { }
@@ -85,6 +85,7 @@ struct DocumentDBTaggedMetrics : metrics::MetricSet
     struct IndexMetrics : metrics::MetricSet
     {
         MemoryUsageMetrics memoryUsage;
+        metrics::DoubleValueMetric fusionThroughput;
 
         IndexMetrics(metrics::MetricSet *parent);
         ~IndexMetrics();
@@ -28,7 +28,8 @@ LegacyDocumentDBMetrics::DocstoreMetrics::DocstoreMetrics(MetricSet *parent)
       hits(0),
       cacheHitRate("cachehitrate", "", "Rate of cache hits in summary cache", this),
       cacheElements("cacheelements", "", "Number of elements in summary cache", this),
-      cacheMemoryUsed("cachememoryused", "", "Memory used by summary cache", this)
+      cacheMemoryUsed("cachememoryused", "", "Memory used by summary cache", this),
+      cacheEvictions("cacheevictions", "", "Number of elements evicted from summary cache", this)
 { }
 
 LegacyDocumentDBMetrics::DocstoreMetrics::~DocstoreMetrics() {}
@@ -37,6 +37,7 @@ struct LegacyDocumentDBMetrics : metrics::MetricSet
         metrics::LongAverageMetric cacheHitRate;
         metrics::LongValueMetric cacheElements;
         metrics::LongValueMetric cacheMemoryUsed;
+        metrics::LongCountMetric cacheEvictions;
 
         DocstoreMetrics(metrics::MetricSet *parent);
         ~DocstoreMetrics();
@@ -4,7 +4,9 @@
 
 #include "document_meta_store_read_guards.h"
 #include "document_subdb_collection_explorer.h"
+#include "initializer_progress_explorer.h"
 #include "maintenance_controller_explorer.h"
+#include "replay_progress_explorer.h"
 #include <vespa/searchcore/proton/common/state_reporter_utils.h>
 #include <vespa/searchcore/proton/bucketdb/bucket_db_explorer.h>
 #include <vespa/searchcore/proton/matching/session_manager_explorer.h>
@@ -48,11 +50,13 @@ const vespalib::string SUB_DB = "subdb";
 const vespalib::string BUCKET_DB = "bucketdb";
 const vespalib::string MAINTENANCE_CONTROLLER = "maintenancecontroller";
 const vespalib::string SESSION = "session";
+const vespalib::string INITIALIZER = "initializer";
+const vespalib::string REPLAY = "replay";
 
 std::vector<vespalib::string>
 DocumentDBExplorer::get_children_names() const
 {
-    return {SUB_DB, BUCKET_DB, MAINTENANCE_CONTROLLER, SESSION};
+    return {SUB_DB, BUCKET_DB, MAINTENANCE_CONTROLLER, SESSION, INITIALIZER, REPLAY};
 }
 
 std::unique_ptr<StateExplorer>
@@ -71,6 +75,14 @@ DocumentDBExplorer::get_child(vespalib::stringref name) const
     } else if (name == SESSION) {
         return std::unique_ptr<StateExplorer>
             (new matching::SessionManagerExplorer(_docDb->session_manager()));
+    } else if (name == INITIALIZER) {
+        return std::unique_ptr<StateExplorer>
+            (new InitializerProgressExplorer(_docDb->getInitializerProgress()));
+    } else if (name == REPLAY) {
+        const FeedHandler &feedHandler = _docDb->getFeedHandler();
+        return std::unique_ptr<StateExplorer>
+            (new ReplayProgressExplorer(feedHandler.getTlsReplayProgress(),
+                                        feedHandler.getTransactionLogReplayDone()));
     }
     return std::unique_ptr<StateExplorer>(nullptr);
 }
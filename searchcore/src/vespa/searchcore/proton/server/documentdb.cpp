@@ -112,6 +112,9 @@ DocumentDB::DocumentDB(const vespalib::string &baseDir,
                     indexing_thread_stack_size,
                     _defaultExecutorTaskLimit),
       _initializeThreads(initializeThreads),
+      _initializeMaxConcurrentTasks(std::max(0, protonCfg.initialize.maxconcurrenttasks)),
+      _replayThreads(std::max(1, protonCfg.replay.threads)),
+      _initializerProgress(std::make_shared<initializer::InitializerProgress>()),
       _initConfigSnapshot(),
       _initConfigSerialNum(0u),
       _pendingConfigSnapshot(configSnapshot),
@@ -281,7 +284,9 @@ DocumentDB::initManagers()
                                   _protonSummaryCfg, _protonIndexCfg);
     InitializeThreads initializeThreads = _initializeThreads;
     _initializeThreads.reset();
-    std::shared_ptr<TaskRunner> taskRunner(std::make_shared<TaskRunner>(*initializeThreads));
+    std::shared_ptr<TaskRunner> taskRunner(std::make_shared<TaskRunner>(*initializeThreads,
+                                                                          _initializeMaxConcurrentTasks,
+                                                                          _initializerProgress));
     auto doneTask = std::make_unique<InitDoneTask>(std::move(initializeThreads), taskRunner,
                                                    std::move(configSnapshot), *this);
     taskRunner->runTask(rootTask, _writeService.master(), std::move(doneTask));
@@ -720,7 +725,8 @@ DocumentDB::startTransactionLogReplay()
                                       getBackingStore().lastSyncToken(),
                                       oldestFlushedSerial,
                                       newestFlushedSerial,
-                                      *_config_store);
+                                      *_config_store,
+                                      _replayThreads);
     _initGate.countDown();
 
     LOG(debug, "DocumentDB(%s): Database started.", _docTypeName.toString().c_str());
@@ -1056,10 +1062,15 @@ namespace {
 
 void
 updateIndexMetrics(DocumentDBMetricsCollection &metrics,
-                   const search::SearchableStats &stats)
+                   const IDocumentSubDB &readySubDB)
 {
+    search::SearchableStats stats = readySubDB.getSearchableStats();
     DocumentDBTaggedMetrics::IndexMetrics &indexMetrics = metrics.getTaggedMetrics().index;
     indexMetrics.memoryUsage.update(stats.memoryUsage());
+    const searchcorespi::IIndexManager::SP &indexManager = readySubDB.getIndexManager();
+    if (indexManager) {
+        indexMetrics.fusionThroughput.set(indexManager->getFusionThroughput());
+    }
 
     LegacyDocumentDBMetrics::IndexMetrics &legacyIndexMetrics = metrics.getLegacyMetrics().index;
     legacyIndexMetrics.memoryUsage.set(stats.memoryUsage().allocatedBytes());
@@ -1232,6 +1243,9 @@ updateDocstoreMetrics(LegacyDocumentDBMetrics::DocstoreMetrics &metrics,
     metrics.hits = cache_stats.hits;
     metrics.cacheElements.set(cache_stats.elements);
     metrics.cacheMemoryUsed.set(cache_stats.memory_used);
+    if (cache_stats.evictions >= lastCacheStats.evictions) {
+        metrics.cacheEvictions.inc(cache_stats.evictions - lastCacheStats.evictions);
+    }
     lastCacheStats = cache_stats;
 }
 
@@ -1269,7 +1283,7 @@ void
 DocumentDB::updateMetrics(DocumentDBMetricsCollection &metrics)
 {
     updateLegacyMetrics(metrics.getLegacyMetrics());
-    updateIndexMetrics(metrics, _subDBs.getReadySubDB()->getSearchableStats());
+    updateIndexMetrics(metrics, *_subDBs.getReadySubDB());
     updateAttributeMetrics(metrics, _subDBs);
     updateMetrics(metrics.getTaggedMetrics());
 }
@@ -21,6 +21,7 @@
 
 #include <vespa/searchcore/proton/common/doctypename.h>
 #include <vespa/searchcore/proton/common/monitored_refcount.h>
+#include <vespa/searchcore/proton/initializer/initializer_progress.h>
 #include <vespa/searchcore/proton/matching/sessionmanager.h>
 #include <vespa/searchcore/proton/metrics/documentdb_job_trackers.h>
 #include <vespa/searchcore/proton/metrics/documentdb_metrics_collection.h>
@@ -85,6 +86,9 @@ private:
     ExecutorThreadingService      _writeService;
     // threads for initializer tasks during proton startup
     InitializeThreads             _initializeThreads;
+    uint32_t                      _initializeMaxConcurrentTasks;
+    uint32_t                      _replayThreads;
+    initializer::InitializerProgress::SP _initializerProgress;
 
     typedef search::SerialNum      SerialNum;
     typedef fastos::TimeStamp      TimeStamp;
@@ -256,6 +260,14 @@ public:
         return *_sessionManager;
     }
 
+    /**
+     * State and load time of initializer tasks. This is used by the
+     * document db explorer.
+     **/
+    const initializer::InitializerProgress &getInitializerProgress() const {
+        return *_initializerProgress;
+    }
+
     /**
      * Frees any allocated resources. This will also stop the internal thread
      * and wait for it to finish. All pending tasks are deleted.
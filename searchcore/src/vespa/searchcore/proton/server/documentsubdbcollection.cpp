@@ -53,6 +53,7 @@ DocumentSubDBCollection::DocumentSubDBCollection(
     search::GrowStrategy notReadyGrowth(growCfg.initial * (distCfg.redundancy - distCfg.searchablecopies), growCfg.factor, growCfg.add);
     size_t attributeGrowNumDocs(growCfg.numdocs);
     size_t numSearcherThreads = protonCfg.numsearcherthreads;
+    uint32_t numIndexingThreads = std::max(1, protonCfg.indexing.threads);
 
     StoreOnlyDocSubDB::Context context(owner,
                                        tlSyncer,
@@ -78,7 +79,8 @@ DocumentSubDBCollection::DocumentSubDBCollection(
                         true,
                         true,
                         false),
-                        numSearcherThreads),
+                        numSearcherThreads,
+                        numIndexingThreads),
                 SearchableDocSubDB::Context(FastAccessDocSubDB::Context
                         (context,
                          AttributeMetricsCollection(metrics.getTaggedMetrics().ready.attributes,
@@ -395,6 +395,9 @@ FeedHandler::performEof()
     LOG(debug,
         "Visiting done for transaction log domain '%s', eof received",
         _tlsMgr.getDomainName().c_str());
+    if (_tlsReplayProgress) {
+        _tlsReplayProgress->markDone();
+    }
     _owner.onTransactionLogReplayDone();
     _tlsMgr.replayDone();
     changeToNormalFeedState();
@@ -548,7 +551,8 @@ FeedHandler::replayTransactionLog(SerialNum flushedIndexMgrSerial,
                                   SerialNum flushedSummaryMgrSerial,
                                   SerialNum oldestFlushedSerial,
                                   SerialNum newestFlushedSerial,
-                                  ConfigStore &config_store)
+                                  ConfigStore &config_store,
+                                  uint32_t replayThreads)
 {
     (void) newestFlushedSerial;
     assert(_activeFeedView);
@@ -558,7 +562,8 @@ FeedHandler::replayTransactionLog(SerialNum flushedIndexMgrSerial,
                            _activeFeedView,
                            *_bucketDBHandler,
                            _replayConfig,
-                           config_store);
+                           config_store,
+                           replayThreads);
     changeFeedState(state);
     // Resurrected attribute vector might cause oldestFlushedSerial to
     // be lower than _prunedSerialNum, so don't warn for now.
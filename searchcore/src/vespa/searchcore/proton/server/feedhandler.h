@@ -214,6 +214,8 @@ public:
      * @param flushedSummaryMgrSerial The flushed serial number of the
      *                                document store.
      * @param config_store            Reference to the config store.
+     * @param replayThreads           Number of threads used to deserialize
+     *                                the replayed operations.
      */
 
     void
@@ -221,7 +223,8 @@ public:
                          SerialNum flushedSummaryMgrSerial,
                          SerialNum oldestFlushedSerial,
                          SerialNum newestFlushedSerial,
-                         ConfigStore &config_store);
+                         ConfigStore &config_store,
+                         uint32_t replayThreads = 1);
 
     /**
      * Called when a flush is done and allows pruning of the transaction log.
@@ -268,6 +271,7 @@ public:
     float getReplayProgress() const {
         return _tlsReplayProgress.get() != nullptr ? _tlsReplayProgress->getProgress() : 0;
     }
+    const TlsReplayProgress *getTlsReplayProgress() const { return _tlsReplayProgress.get(); }
     bool getTransactionLogReplayDone() const;
     vespalib::string getDocTypeName() const { return _docTypeName.getName(); }
     void tlsPrune(SerialNum oldest_to_keep);
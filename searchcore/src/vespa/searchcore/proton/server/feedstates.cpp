@@ -8,8 +8,11 @@
 #include <vespa/searchcore/proton/bucketdb/ibucketdbhandler.h>
 #include <vespa/searchcore/proton/common/eventlogger.h>
 #include <vespa/searchlib/common/idestructorcallback.h>
+#include <vespa/searchlib/common/lambdatask.h>
 #include <vespa/vespalib/util/closuretask.h>
 #include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/threadstackexecutor.h>
+#include <cassert>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".proton.server.feedstates");
@@ -17,7 +20,9 @@ LOG_SETUP(".proton.server.feedstates");
 using search::transactionlog::Packet;
 using search::transactionlog::RPC;
 using search::SerialNum;
+using search::makeLambdaTask;
 using vespalib::Executor;
+using vespalib::ThreadStackExecutor;
 using vespalib::IllegalStateException;
 using vespalib::makeClosure;
 using vespalib::makeTask;
@@ -27,9 +32,9 @@ using proton::bucketdb::IBucketDBHandler;
 namespace proton {
 
 namespace {
-typedef vespalib::Closure1<const Packet::Entry &>::UP EntryHandler;
-
 const search::SerialNum REPLAY_PROGRESS_INTERVAL = 50000;
+const size_t MIN_ENTRIES_PER_TASK = 8;
+const uint32_t deserialize_thread_stack_size = 128 * 1024;
 
 void
 handleProgress(TlsReplayProgress &progress, SerialNum currentSerial)
@@ -46,22 +51,6 @@ handleProgress(TlsReplayProgress &progress, SerialNum currentSerial)
     }
 }
 
-void
-handlePacket(PacketWrapper::SP wrap, EntryHandler entryHandler)
-{
-    vespalib::nbostream_longlivedbuf handle(wrap->packet.getHandle().c_str(), wrap->packet.getHandle().size());
-    while (handle.size() > 0) {
-        Packet::Entry entry;
-        entry.deserialize(handle);
-        entryHandler->call(entry);
-        if (wrap->progress != NULL) {
-            handleProgress(*wrap->progress, entry.serial());
-        }
-    }
-    wrap->result = RPC::OK;
-    wrap->gate.countDown();
-}
-
 class TransactionLogReplayPacketHandler : public IReplayPacketHandler {
     IFeedView *& _feed_view_ptr;  // Pointer can be changed in executor thread.
     IBucketDBHandler &_bucketDBHandler;
@@ -136,15 +125,107 @@ public:
     }
 };
 
-void startDispatch(IReplayPacketHandler *packet_handler,
-                   const Packet::Entry &entry) {
-    // Called by handlePacket() in executor thread.
-    LOG(spam,
-        "replay packet entry: entrySerial(%" PRIu64 "), entryType(%u)",
-        entry.serial(), entry.type());
+/**
+ * Returns the end of the run of entries starting at begin that can be
+ * deserialized with the same document type repo, i.e. the position of the
+ * next NEW_CONFIG entry.
+ */
+size_t
+findRunEnd(const std::vector<Packet::Entry> &entries, size_t begin)
+{
+    size_t end = begin;
+    while (end < entries.size() && entries[end].type() != FeedOperation::NEW_CONFIG) {
+        ++end;
+    }
+    return end;
+}
 
+void
+deserializeRange(const std::vector<Packet::Entry> &entries, size_t begin, size_t end,
+                 const document::DocumentTypeRepo &repo, std::vector<FeedOperation::UP> &ops)
+{
+    for (size_t i = begin; i < end; ++i) {
+        ops[i] = ReplayPacketDispatcher::deserializeEntry(entries[i], repo);
+    }
+}
+
+/**
+ * Deserialize the entries in [begin, end) into ops. The work is split
+ * between the calling thread and the threads of the given executor.
+ */
+void
+deserializeEntries(const std::vector<Packet::Entry> &entries, size_t begin, size_t end,
+                   const document::DocumentTypeRepo &repo, std::vector<FeedOperation::UP> &ops,
+                   ThreadStackExecutor &executor, uint32_t numThreads)
+{
+    size_t numEntries = end - begin;
+    size_t numTasks = std::max(size_t(1), std::min(size_t(numThreads), numEntries / MIN_ENTRIES_PER_TASK));
+    std::vector<std::exception_ptr> errors(numTasks);
+    vespalib::CountDownLatch latch(numTasks - 1);
+    for (size_t task = 1; task < numTasks; ++task) {
+        size_t taskBegin = begin + (numEntries * task) / numTasks;
+        size_t taskEnd = begin + (numEntries * (task + 1)) / numTasks;
+        Executor::Task::UP rejected = executor.execute(makeLambdaTask([&, task, taskBegin, taskEnd]() {
+            try {
+                deserializeRange(entries, taskBegin, taskEnd, repo, ops);
+            } catch (...) {
+                errors[task] = std::current_exception();
+            }
+            latch.countDown();
+        }));
+        assert(!rejected);
+    }
+    try {
+        deserializeRange(entries, begin, begin + numEntries / numTasks, repo, ops);
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    latch.await();
+    for (const auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+void
+handlePacket(PacketWrapper::SP wrap, IReplayPacketHandler *packet_handler,
+             ThreadStackExecutor *deserialize_executor, uint32_t deserialize_threads)
+{
+    // Called in executor thread.
     ReplayPacketDispatcher dispatcher(*packet_handler);
-    dispatcher.replayEntry(entry);
+    vespalib::nbostream_longlivedbuf handle(wrap->packet.getHandle().c_str(), wrap->packet.getHandle().size());
+    std::vector<Packet::Entry> entries;
+    while (handle.size() > 0) {
+        entries.emplace_back();
+        entries.back().deserialize(handle);
+    }
+    std::vector<FeedOperation::UP> ops(entries.size());
+    size_t runEnd = 0;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const Packet::Entry &entry = entries[i];
+        LOG(spam,
+            "replay packet entry: entrySerial(%" PRIu64 "), entryType(%u)",
+            entry.serial(), entry.type());
+        if (deserialize_executor == nullptr || entry.type() == FeedOperation::NEW_CONFIG) {
+            dispatcher.replayEntry(entry);
+        } else {
+            if (i >= runEnd) {
+                // A NEW_CONFIG entry might change the document type repo,
+                // so only deserialize ahead until the next one.
+                runEnd = findRunEnd(entries, i);
+                deserializeEntries(entries, i, runEnd, packet_handler->getDeserializeRepo(), ops,
+                                   *deserialize_executor, deserialize_threads);
+            }
+            dispatcher.replayOperation(*ops[i]);
+            ops[i].reset();
+        }
+        if (wrap->progress != NULL) {
+            handleProgress(*wrap->progress, entry.serial());
+        }
+    }
+    wrap->result = RPC::OK;
+    wrap->gate.countDown();
 }
 
 }  // namespace
@@ -154,18 +235,29 @@ ReplayTransactionLogState::ReplayTransactionLogState(
         IFeedView *& feed_view_ptr,
         IBucketDBHandler &bucketDBHandler,
         IReplayConfig &replay_config,
-        FeedConfigStore &config_store)
+        FeedConfigStore &config_store,
+        uint32_t deserialize_threads)
     : FeedState(REPLAY_TRANSACTION_LOG),
       _doc_type_name(name),
       _packet_handler(new TransactionLogReplayPacketHandler(
                       feed_view_ptr, bucketDBHandler,
-                      replay_config, config_store)) {
+                      replay_config, config_store)),
+      _deserialize_threads(std::max(1u, deserialize_threads)),
+      _deserialize_executor() {
+    if (_deserialize_threads > 1) {
+        // The executor thread doing the replay deserializes a share of
+        // the entries itself, so it needs one thread less.
+        _deserialize_executor = std::make_unique<ThreadStackExecutor>(_deserialize_threads - 1,
+                                                                      deserialize_thread_stack_size);
+    }
 }
 
+ReplayTransactionLogState::~ReplayTransactionLogState() = default;
+
 void ReplayTransactionLogState::receive(const PacketWrapper::SP &wrap,
                                         Executor &executor) {
-    EntryHandler closure = makeClosure(&startDispatch, _packet_handler.get());
-    executor.execute(makeTask(makeClosure(&handlePacket, wrap, std::move(closure))));
+    executor.execute(makeTask(makeClosure(&handlePacket, wrap, _packet_handler.get(),
+                                          _deserialize_executor.get(), _deserialize_threads)));
 }
 
 }  // namespace proton
@@ -6,6 +6,8 @@
 #include <vespa/searchcore/proton/server/feedstate.h>
 #include <vespa/searchcore/proton/server/ireplaypackethandler.h>
 
+namespace vespalib { class ThreadStackExecutor; }
+
 namespace proton {
 
 /**
@@ -45,17 +47,25 @@ public:
 /**
  * The feed handler is replaying the transaction log.
  * Replayed messages from the transaction log are sent to the active feed view.
+ *
+ * When given more than one deserialize thread, the entries of each packet
+ * are deserialized in parallel. The resulting operations are still sent to
+ * the feed view one at a time in serial number order.
  */
 class ReplayTransactionLogState : public FeedState {
     vespalib::string _doc_type_name;
     std::unique_ptr<IReplayPacketHandler> _packet_handler;
+    uint32_t _deserialize_threads;
+    std::unique_ptr<vespalib::ThreadStackExecutor> _deserialize_executor;
 
 public:
     ReplayTransactionLogState(const vespalib::string &name,
             IFeedView *& feed_view_ptr,
             bucketdb::IBucketDBHandler &bucketDBHandler,
             IReplayConfig &replay_config,
-            FeedConfigStore &config_store);
+            FeedConfigStore &config_store,
+            uint32_t deserialize_threads = 1);
+    ~ReplayTransactionLogState();
 
     virtual void handleOperation(FeedToken, FeedOperation::UP op) override {
         throwExceptionInHandleOperation(_doc_type_name, *op);
@@ -0,0 +1,60 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "initializer_progress_explorer.h"
+#include <vespa/vespalib/data/slime/cursor.h>
+
+using vespalib::slime::Cursor;
+using vespalib::slime::Inserter;
+using proton::initializer::InitializerProgress;
+
+namespace proton {
+
+namespace {
+
+const char *
+stateToString(InitializerProgress::State state)
+{
+    switch (state) {
+    case InitializerProgress::State::BLOCKED:
+        return "blocked";
+    case InitializerProgress::State::RUNNING:
+        return "running";
+    case InitializerProgress::State::DONE:
+        return "done";
+    }
+    return "unknown";
+}
+
+}
+
+InitializerProgressExplorer::InitializerProgressExplorer(const InitializerProgress &progress)
+    : _progress(progress)
+{
+}
+
+void
+InitializerProgressExplorer::get_state(const Inserter &inserter, bool full) const
+{
+    Cursor &object = inserter.insertObject();
+    std::vector<InitializerProgress::TaskInfo> tasks = _progress.getTasks();
+    InitializerProgress::Clock::time_point now = InitializerProgress::Clock::now();
+    uint32_t runningTasks = 0;
+    for (const auto &task : tasks) {
+        if (task.state == InitializerProgress::State::RUNNING) {
+            ++runningTasks;
+        }
+    }
+    object.setLong("startedTasks", tasks.size());
+    object.setLong("runningTasks", runningTasks);
+    if (full) {
+        Cursor &array = object.setArray("tasks");
+        for (const auto &task : tasks) {
+            Cursor &taskObject = array.addObject();
+            taskObject.setString("name", task.name);
+            taskObject.setString("state", stateToString(task.state));
+            taskObject.setLong("elapsedMs", task.elapsed(now).count());
+        }
+    }
+}
+
+} // namespace proton
@@ -0,0 +1,26 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/searchcore/proton/initializer/initializer_progress.h>
+#include <vespa/vespalib/net/state_explorer.h>
+
+namespace proton {
+
+/**
+ * Class used to explore the state and load time of the initializer
+ * tasks of a document database.
+ */
+class InitializerProgressExplorer : public vespalib::StateExplorer
+{
+private:
+    const initializer::InitializerProgress &_progress;
+
+public:
+    InitializerProgressExplorer(const initializer::InitializerProgress &progress);
+
+    // Implements vespalib::StateExplorer
+    virtual void get_state(const vespalib::slime::Inserter &inserter, bool full) const override;
+};
+
+} // namespace proton
@@ -0,0 +1,38 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "replay_progress_explorer.h"
+#include "tls_replay_progress.h"
+#include <vespa/vespalib/data/slime/cursor.h>
+
+using vespalib::slime::Cursor;
+using vespalib::slime::Inserter;
+
+namespace proton {
+
+ReplayProgressExplorer::ReplayProgressExplorer(const TlsReplayProgress *progress, bool replayDone)
+    : _progress(progress),
+      _replayDone(replayDone)
+{
+}
+
+void
+ReplayProgressExplorer::get_state(const Inserter &inserter, bool full) const
+{
+    Cursor &object = inserter.insertObject();
+    object.setBool("done", _replayDone);
+    if (_progress == nullptr) {
+        return;
+    }
+    object.setDouble("progress", _progress->getProgress());
+    object.setLong("operations", _progress->getNumOperations());
+    object.setDouble("operationsPerSecond", _progress->getOperationsPerSecond());
+    if (full) {
+        object.setString("domain", _progress->getDomainName());
+        object.setLong("first", _progress->getFirst());
+        object.setLong("last", _progress->getLast());
+        object.setLong("current", _progress->getCurrent());
+        object.setLong("elapsedMs", _progress->getElapsed().count());
+    }
+}
+
+} // namespace proton
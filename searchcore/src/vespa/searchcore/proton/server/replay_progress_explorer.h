@@ -0,0 +1,28 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/net/state_explorer.h>
+
+namespace proton {
+
+class TlsReplayProgress;
+
+/**
+ * Class used to explore the progress and throughput of the transaction
+ * log replay of a document database.
+ */
+class ReplayProgressExplorer : public vespalib::StateExplorer
+{
+private:
+    const TlsReplayProgress *_progress;
+    bool _replayDone;
+
+public:
+    ReplayProgressExplorer(const TlsReplayProgress *progress, bool replayDone);
+
+    // Implements vespalib::StateExplorer
+    virtual void get_state(const vespalib::slime::Inserter &inserter, bool full) const override;
+};
+
+} // namespace proton
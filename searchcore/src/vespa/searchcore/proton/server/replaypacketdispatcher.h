@@ -19,7 +19,7 @@ private:
     IReplayPacketHandler &_handler;
 
     template <typename OperationType>
-    void replay(OperationType &op, vespalib::nbostream &is, const Packet::Entry &entry);
+    void replay(const FeedOperation &op);
 
 protected:
     virtual void
@@ -32,6 +32,20 @@ public:
     ~ReplayPacketDispatcher();
 
     void replayEntry(const Packet::Entry &entry);
+
+    /**
+     * Deserialize a packet entry into a feed operation using the given
+     * document type repo. Does not touch any dispatcher state, and can be
+     * called from several threads at the same time. NEW_CONFIG entries
+     * can not be deserialized this way and must be given to replayEntry().
+     */
+    static FeedOperation::UP
+    deserializeEntry(const Packet::Entry &entry, const document::DocumentTypeRepo &repo);
+
+    /**
+     * Dispatch a feed operation returned by deserializeEntry() to the handler.
+     */
+    void replayOperation(const FeedOperation &op);
 };
 
 } // namespace proton
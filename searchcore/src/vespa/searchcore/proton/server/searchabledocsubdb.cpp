@@ -13,10 +13,12 @@
 #include <vespa/searchcore/proton/reference/document_db_reference.h>
 #include <vespa/searchcore/proton/reference/gid_to_lid_change_handler.h>
 #include <vespa/searchcorespi/plugin/iindexmanagerfactory.h>
+#include <vespa/searchlib/common/lambdatask.h>
 #include <vespa/vespalib/io/fileutil.h>
 #include <vespa/vespalib/util/closuretask.h>
 #include <vespa/eval/tensor/default_tensor_engine.h>
 #include <vespa/vespalib/util/exceptions.h>
+#include <future>
 
 using vespa::config::search::AttributesConfig;
 using vespa::config::search::RankProfilesConfig;
@@ -28,6 +30,7 @@ using search::AttributeVector;
 using search::GrowStrategy;
 using search::TuneFileDocumentDB;
 using search::index::Schema;
+using search::makeLambdaTask;
 using search::SerialNum;
 using vespalib::IllegalStateException;
 using vespalib::ThreadStackExecutorBase;
@@ -48,6 +51,7 @@ SearchableDocSubDB::SearchableDocSubDB(const Config &cfg, const Context &ctx)
       _configurer(_iSummaryMgr, _rSearchView, _rFeedView, ctx._queryLimiter, _constantValueRepo, ctx._clock,
                   getSubDbName(), ctx._fastUpdCtx._storeOnlyCtx._owner.getDistributionKey()),
       _numSearcherThreads(cfg._numSearcherThreads),
+      _numIndexingThreads(cfg._numIndexingThreads),
       _warmupExecutor(ctx._warmupExecutor),
       _gidToLidChangeHandler(std::make_shared<GidToLidChangeHandler>(&_writeService.master()))
 { }
@@ -92,12 +96,19 @@ createIndexManagerInitializer(const DocumentDBConfig &configSnapshot,
 {
     Schema::SP schema(configSnapshot.getSchemaSP());
     vespalib::string vespaIndexDir(_baseDir + "/index");
+    // Each field partition is inverted by its own indexing thread, more partitions gain nothing
+    uint32_t numFieldPartitions = std::min(static_cast<uint32_t>(std::max(1, indexCfg.fieldpartitions)),
+                                           _numIndexingThreads);
     // Note: const_cast for reconfigurer role
     return std::make_shared<IndexManagerInitializer>
         (vespaIndexDir,
+         getSubDbName(),
          searchcorespi::index::WarmupConfig(indexCfg.warmup.time, indexCfg.warmup.unpack),
          indexCfg.maxflushed,
          indexCfg.cache.size,
+         numFieldPartitions,
+         indexCfg.replay.bulkload,
+         indexCfg.fusion.threads,
          *schema,
          configSerialNum,
          const_cast<SearchableDocSubDB &>(*this),
@@ -312,6 +323,18 @@ SearchableDocSubDB::setIndexSchema(const Schema::SP &schema, SerialNum serialNum
     reconfigureIndexSearchable();
 }
 
+void
+SearchableDocSubDB::onReplayDone()
+{
+    // Called by document db executor thread
+    Parent::onReplayDone();
+    // Turn off bulk load, making documents deferred during replay searchable
+    std::promise<bool> promise;
+    std::future<bool> future = promise.get_future();
+    _writeService.index().execute(makeLambdaTask([&]() { _indexMgr->setBulkLoad(0); promise.set_value(true); }));
+    (void) future.get();
+}
+
 size_t
 SearchableDocSubDB::getNumActiveDocs() const
 {
@@ -47,10 +47,13 @@ public:
     struct Config {
         const FastAccessDocSubDB::Config _fastUpdCfg;
         const size_t _numSearcherThreads;
+        const uint32_t _numIndexingThreads;
 
-        Config(const FastAccessDocSubDB::Config &fastUpdCfg, size_t numSearcherThreads)
+        Config(const FastAccessDocSubDB::Config &fastUpdCfg, size_t numSearcherThreads,
+               uint32_t numIndexingThreads)
             : _fastUpdCfg(fastUpdCfg),
-              _numSearcherThreads(numSearcherThreads)
+              _numSearcherThreads(numSearcherThreads),
+              _numIndexingThreads(numIndexingThreads)
         { }
     };
 
@@ -84,6 +87,7 @@ private:
     matching::ConstantValueRepo                 _constantValueRepo;
     SearchableDocSubDBConfigurer                _configurer;
     const size_t                                _numSearcherThreads;
+    const uint32_t                              _numIndexingThreads;
     vespalib::ThreadExecutor                   &_warmupExecutor;
     std::shared_ptr<GidToLidChangeHandler>      _gidToLidChangeHandler;
 
@@ -157,6 +161,7 @@ public:
     SerialNum getOldestFlushedSerial() override;
     SerialNum getNewestFlushedSerial() override;
     void setIndexSchema(const Schema::SP &schema, SerialNum serialNum) override;
+    void onReplayDone() override;
     size_t getNumActiveDocs() const override;
     search::SearchableStats getSearchableStats() const override ;
     IDocumentRetriever::UP getDocumentRetriever() override;
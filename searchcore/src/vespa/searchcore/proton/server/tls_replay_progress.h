@@ -4,16 +4,33 @@
 
 #include <vespa/searchlib/common/serialnum.h>
 #include <vespa/vespalib/stllike/string.h>
+#include <atomic>
+#include <chrono>
 
 namespace proton {
 
+/**
+ * Progress of a transaction log replay. Updated by the thread replaying
+ * the transaction log, and read by the state explorer and status reporting.
+ */
 class TlsReplayProgress
 {
+public:
+    using Clock = std::chrono::steady_clock;
+
 private:
     const vespalib::string  _domainName;
     const search::SerialNum _first;
     const search::SerialNum _last;
-    search::SerialNum       _current;
+    std::atomic<search::SerialNum> _current;
+    std::atomic<uint64_t>   _numOperations;
+    const Clock::time_point _startTime;
+    Clock::time_point       _endTime;
+    std::atomic<bool>       _done;
+
+    Clock::time_point getEndTime() const {
+        return _done.load(std::memory_order_acquire) ? _endTime : Clock::now();
+    }
 
 public:
     typedef std::unique_ptr<TlsReplayProgress> UP;
@@ -24,21 +41,47 @@ public:
         : _domainName(domainName),
           _first(first),
           _last(last),
-          _current(first)
+          _current(first),
+          _numOperations(0),
+          _startTime(Clock::now()),
+          _endTime(),
+          _done(false)
     {
     }
     const vespalib::string &getDomainName() const { return _domainName; }
     search::SerialNum getFirst() const { return _first; }
     search::SerialNum getLast() const { return _last; }
-    search::SerialNum getCurrent() const { return _current; }
+    search::SerialNum getCurrent() const { return _current.load(std::memory_order_relaxed); }
+    uint64_t getNumOperations() const { return _numOperations.load(std::memory_order_relaxed); }
     float getProgress() const {
         if (_first == _last) {
             return 1.0;
         } else {
-            return ((float)(_current - _first)/float(_last - _first));
+            return ((float)(getCurrent() - _first)/float(_last - _first));
         }
     }
-    void updateCurrent(search::SerialNum current) { _current = current; }
+    std::chrono::milliseconds getElapsed() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(getEndTime() - _startTime);
+    }
+    double getOperationsPerSecond() const {
+        double elapsedSecs = std::chrono::duration<double>(getEndTime() - _startTime).count();
+        return (elapsedSecs > 0.0) ? (getNumOperations() / elapsedSecs) : 0.0;
+    }
+    /**
+     * Called once for each replayed transaction log entry.
+     */
+    void updateCurrent(search::SerialNum current) {
+        _current.store(current, std::memory_order_relaxed);
+        _numOperations.fetch_add(1, std::memory_order_relaxed);
+    }
+    /**
+     * Called when the replay is done. Elapsed time and rate are frozen
+     * at this point.
+     */
+    void markDone() {
+        _endTime = Clock::now();
+        _done.store(true, std::memory_order_release);
+    }
 };
 
 } // namespace proton
@@ -7,4 +7,15 @@ IIndexManager::Reconfigurer::~Reconfigurer()
 {
 }
 
+void
+IIndexManager::setBulkLoad(uint32_t)
+{
+}
+
+double
+IIndexManager::getFusionThroughput() const
+{
+    return 0.0;
+}
+
 } // namespace searchcorespi
@@ -157,6 +157,23 @@ public:
      * @param schema The new schema to start using.
      **/
     virtual void setSchema(const Schema &schema, SerialNum serialNum) = 0;
+
+    /**
+     * Sets bulk load mode for the memory index, deferring commits until
+     * bulkLoadDocs documents have been put or removed. Used while replaying
+     * the transaction log. 0 turns bulk load mode off and makes deferred
+     * documents searchable.
+     *
+     * @param bulkLoadDocs The number of documents to buffer before pushing.
+     **/
+    virtual void setBulkLoad(uint32_t bulkLoadDocs);
+
+    /**
+     * Returns the throughput of the last completed fusion.
+     *
+     * @return bytes of disk index written per second, 0 if no fusion has completed.
+     **/
+    virtual double getFusionThroughput() const;
 };
 
 } // namespace searchcorespi
@@ -63,6 +63,13 @@ struct IMemoryIndex : public searchcorespi::IndexSearchable {
      **/
     virtual void commit(OnWriteDoneType onWriteDone, search::SerialNum serialNum) = 0;
 
+    /**
+     * Sets bulk load mode, deferring commits until bulkLoadDocs documents
+     * have been inserted or removed. 0 turns bulk load mode off and makes
+     * deferred documents searchable.
+     **/
+    virtual void setBulkLoad(uint32_t bulkLoadDocs) = 0;
+
     /**
      * Flushes this memory index to disk as a disk index.
      * After a flush it should be possible to load a IDiskIndex from the flush directory.
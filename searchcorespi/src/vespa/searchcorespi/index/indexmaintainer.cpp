@@ -472,7 +472,9 @@ IndexMaintainer::doneInitFlush(FlushArgs *args, IMemoryIndex::SP *new_index)
             assert(_current_index_id < ISourceSelector::SOURCE_LIMIT);
             _source_selector_changes = 0;
         }
+        _current_index->setBulkLoad(0); // Push documents deferred by bulk load
         _current_index = *new_index;
+        _current_index->setBulkLoad(_bulkLoadDocs);
     }
     if (args->_skippedEmptyLast) {
         replaceSource(_current_index_id, _current_index);
@@ -749,7 +751,9 @@ IndexMaintainer::doneSetSchema(SetSchemaArgs &args, IMemoryIndex::SP &newIndex)
             // Extra index to flush next time flushing is performed
             _frozenMemoryIndexes.emplace_back(args._oldIndex, freezeSerialNum, std::move(saveInfo), oldAbsoluteId);
         }
+        _current_index->setBulkLoad(0); // Push documents deferred by bulk load
         _current_index = newIndex;
+        _current_index->setBulkLoad(_bulkLoadDocs);
     }
     if (dropEmptyLast) {
         replaceSource(_current_index_id, _current_index);
@@ -815,6 +819,7 @@ IndexMaintainer::IndexMaintainer(const IndexMaintainerConfig &config,
       _current_index_id(),
       _current_index(),
       _current_serial_num(0),
+      _bulkLoadDocs(config.getBulkLoadDocs()),
       _flush_serial_num(0),
       _lastFlushTime(),
       _frozenMemoryIndexes(),
@@ -824,6 +829,7 @@ IndexMaintainer::IndexMaintainer(const IndexMaintainerConfig &config,
       _remove_lock(),
       _fusion_spec(),
       _fusion_lock(),
+      _lastFusionThroughput(0.0),
       _maxFlushed(config.getMaxFlushed()),
       _maxFrozen(10),
       _changeGens(),
@@ -863,6 +869,7 @@ IndexMaintainer::IndexMaintainer(const IndexMaintainerConfig &config,
         assert(_last_fusion_id == _selector->getBaseId());
     }
     _current_index = operations.createMemoryIndex(_schema, _current_serial_num);
+    _current_index->setBulkLoad(_bulkLoadDocs);
     _current_index_id = getNewAbsoluteId() - _last_fusion_id;
     assert(_current_index_id < ISourceSelector::SOURCE_LIMIT);
     ISearchableIndexCollection::UP sourceList(loadDiskIndexes(spec, ISearchableIndexCollection::UP(new IndexCollection(_selector))));
@@ -983,7 +990,11 @@ IndexMaintainer::runFusion(const FusionSpec &fusion_spec)
         serialNum = IndexReadUtilities::readSerialNum(lastFlushDir);
     }
     FusionRunner fusion_runner(_base_dir, args._schema, tuneFileAttributes, _ctx.getFileHeaderContext());
+    fastos::StopWatch fusionTimer;
+    fusionTimer.start();
     uint32_t new_fusion_id = fusion_runner.fuse(fusion_spec, serialNum, _operations);
+    fusionTimer.stop();
+    double fusionTime = fusionTimer.elapsed().sec();
     bool ok = (new_fusion_id != 0);
     if (ok) {
         ok = IndexWriteUtilities::copySerialNumFile(getFlushDir(fusion_spec.flush_ids.back()),
@@ -1009,6 +1020,12 @@ IndexMaintainer::runFusion(const FusionSpec &fusion_spec)
     }
     ChangeGens changeGens = getChangeGens();
     IDiskIndex::SP new_index(loadDiskIndex(new_fusion_dir));
+    uint64_t fusedBytes = new_index->getSearchableStats().sizeOnDisk();
+    LOG(debug, "Fusion wrote %" PRIu64 " bytes in %.3f seconds", fusedBytes, fusionTime);
+    {
+        LockGuard guard(_fusion_lock);
+        _lastFusionThroughput = (fusionTime > 0.0) ? fusedBytes / fusionTime : 0.0;
+    }
 
     // Post processing after fusion operation has completed and new disk
     // index has been opened.
@@ -1046,6 +1063,14 @@ IndexMaintainer::removeOldDiskIndexes()
     DiskIndexCleaner::removeOldIndexes(_base_dir, *_active_indexes);
 }
 
+double
+IndexMaintainer::getFusionThroughput() const
+{
+    // Called by metrics update thread
+    LockGuard guard(_fusion_lock);
+    return _lastFusionThroughput;
+}
+
 IndexMaintainer::FlushStats
 IndexMaintainer::getFlushStats() const
 {
@@ -1171,6 +1196,15 @@ IndexMaintainer::heartBeat(SerialNum serialNum)
     _current_serial_num = serialNum;
 }
 
+void
+IndexMaintainer::setBulkLoad(uint32_t bulkLoadDocs)
+{
+    assert(_ctx.getThreadingService().index().isCurrentThread());
+    LockGuard lock(_index_update_lock);
+    _bulkLoadDocs = bulkLoadDocs;
+    _current_index->setBulkLoad(bulkLoadDocs);
+}
+
 IFlushTarget::List
 IndexMaintainer::getFlushTargets(void)
 {
@@ -101,6 +101,7 @@ class IndexMaintainer : public IIndexManager,
     uint32_t          _current_index_id; // Protected by SL + IUL
     IMemoryIndex::SP  _current_index;    // Protected by SL + IUL
     SerialNum         _current_serial_num;// Protected by IUL
+    uint32_t          _bulkLoadDocs;      // Protected by IUL
     SerialNum         _flush_serial_num;  // Protected by SL
     fastos::TimeStamp _lastFlushTime; // Protected by SL
     // Extra frozen memory indexes.  This list is empty unless new
@@ -144,6 +145,7 @@ class IndexMaintainer : public IIndexManager,
     // Protected by SL + IUL
     FusionSpec     _fusion_spec;		// Protected by FL
     vespalib::Lock _fusion_lock;	// Fusion spec lock (FL)
+    double         _lastFusionThroughput; // Protected by FL
     uint32_t       _maxFlushed;
     uint32_t       _maxFrozen;
     ChangeGens     _changeGens; // Protected by SL + IUL
@@ -357,6 +359,8 @@ public:
     void removeDocument(uint32_t lid, SerialNum serialNum) override;
     void commit(SerialNum serialNum, OnWriteDoneType onWriteDone) override;
     void heartBeat(search::SerialNum serialNum) override;
+    void setBulkLoad(uint32_t bulkLoadDocs) override;
+    double getFusionThroughput() const override;
 
     SerialNum getCurrentSerialNum() const override {
         return _current_serial_num;
@@ -12,13 +12,15 @@ IndexMaintainerConfig::IndexMaintainerConfig(const vespalib::string &baseDir,
                                              size_t maxFlushed,
                                              const Schema &schema,
                                              const search::SerialNum serialNum,
-                                             const TuneFileAttributes &tuneFileAttributes)
+                                             const TuneFileAttributes &tuneFileAttributes,
+                                             uint32_t bulkLoadDocs)
     : _baseDir(baseDir),
       _warmup(warmup),
       _maxFlushed(maxFlushed),
       _schema(schema),
       _serialNum(serialNum),
-      _tuneFileAttributes(tuneFileAttributes)
+      _tuneFileAttributes(tuneFileAttributes),
+      _bulkLoadDocs(bulkLoadDocs)
 {
 }
 
@@ -20,6 +20,7 @@ private:
     const search::index::Schema _schema;
     const search::SerialNum _serialNum;
     const search::TuneFileAttributes _tuneFileAttributes;
+    const uint32_t _bulkLoadDocs;
 
 public:
     IndexMaintainerConfig(const vespalib::string &baseDir,
@@ -27,7 +28,8 @@ public:
                           size_t maxFlushed,
                           const search::index::Schema &schema,
                           const search::SerialNum serialNum,
-                          const search::TuneFileAttributes &tuneFileAttributes);
+                          const search::TuneFileAttributes &tuneFileAttributes,
+                          uint32_t bulkLoadDocs);
 
     ~IndexMaintainerConfig();
 
@@ -59,6 +61,14 @@ public:
     size_t getMaxFlushed() const {
         return _maxFlushed;
     }
+
+    /**
+     * Returns the number of documents buffered per memory index push
+     * while bulk loading, 0 when not bulk loading.
+     */
+    uint32_t getBulkLoadDocs() const {
+        return _bulkLoadDocs;
+    }
 };
 
 }
@@ -7,6 +7,7 @@
 #include <vespa/eval/eval/operator_nodes.h>
 #include <vespa/vespalib/util/benchmark_timer.h>
 #include <vespa/eval/eval/vm_forest.h>
+#include <vespa/eval/eval/quick_scorer.h>
 #include <vespa/eval/eval/llvm/deinline_forest.h>
 #include <vespa/eval/tensor/default_tensor_engine.h>
 #include <vespa/vespalib/io/mapped_file_input.h>
@@ -242,6 +243,18 @@ bool vmforest_used(const std::vector<Forest::UP> &forests) {
     return true;
 }
 
+bool quick_scorer_used(const std::vector<Forest::UP> &forests) {
+    if (forests.empty()) {
+        return false;
+    }
+    for (const Forest::UP &forest: forests) {
+        if (dynamic_cast<QuickScorer*>(forest.get()) == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 
 struct State {
@@ -292,6 +305,9 @@ struct State {
         if (!vmforest_used(compiled_function->get_forests()) && !fun_info.forests.empty()) {
             benchmark_option("vmforest", VMForest::optimize_chain);
         }
+        if (!quick_scorer_used(compiled_function->get_forests()) && !fun_info.forests.empty()) {
+            benchmark_option("quickscorer", QuickScorer::optimize_chain);
+        }
         fprintf(stdout, "[compile: %.3fs][execute: %.3fus]", llvm_compile_s, llvm_execute_us);
         for (size_t i = 0; i < options.size(); ++i) {
             double rel_speed = (llvm_execute_us / options_us[i]);
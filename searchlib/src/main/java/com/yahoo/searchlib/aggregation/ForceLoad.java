@@ -25,6 +25,7 @@ public class ForceLoad {
                 "CountAggregationResult",
                 "AverageAggregationResult",
                 "ExpressionCountAggregationResult",
+                "TopKAggregationResult",
                 "hll.SparseSketch",
                 "hll.NormalSketch"
         };
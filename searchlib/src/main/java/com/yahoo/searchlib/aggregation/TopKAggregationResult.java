@@ -0,0 +1,226 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+package com.yahoo.searchlib.aggregation;
+
+import com.yahoo.searchlib.expression.IntegerResultNode;
+import com.yahoo.searchlib.expression.ResultNode;
+import com.yahoo.vespa.objects.Deserializer;
+import com.yahoo.vespa.objects.ObjectVisitor;
+import com.yahoo.vespa.objects.Serializer;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.Objects;
+
+/**
+ * Approximates the most frequent values of an expression using the space saving algorithm. Each tracked value has an
+ * estimated count, and an upper bound on how much that count may be overestimated. This is the counterpart of the
+ * aggregator in the search backend, and merges summaries from different content nodes the same way.
+ */
+public class TopKAggregationResult extends AggregationResult {
+
+    public static final int classId = registerClass(0x4000 + 98, TopKAggregationResult.class);
+    private int maxEntries = 16;
+    private List<Entry> entries = new ArrayList<>();
+
+    /**
+     * A value tracked by the aggregator, with its estimated count and the maximum overestimation of that count.
+     */
+    public static class Entry {
+
+        private final ResultNode value;
+        private long count;
+        private long error;
+
+        public Entry(ResultNode value, long count, long error) {
+            this.value = value;
+            this.count = count;
+            this.error = error;
+        }
+
+        public ResultNode getValue() { return value; }
+
+        public long getCount() { return count; }
+
+        public long getError() { return error; }
+
+        private boolean hasValue(ResultNode other) {
+            return value.getClassId() == other.getClassId() && value.equals(other);
+        }
+
+        @Override
+        public boolean equals(Object obj) {
+            if (!(obj instanceof Entry)) {
+                return false;
+            }
+            Entry rhs = (Entry)obj;
+            return hasValue(rhs.value) && count == rhs.count && error == rhs.error;
+        }
+
+        @Override
+        public int hashCode() {
+            return Objects.hash(value, count, error);
+        }
+    }
+
+    public TopKAggregationResult() {
+        // empty
+    }
+
+    public TopKAggregationResult(int maxEntries) {
+        this.maxEntries = maxEntries;
+    }
+
+    public int getMaxEntries() {
+        return maxEntries;
+    }
+
+    public TopKAggregationResult setMaxEntries(int maxEntries) {
+        this.maxEntries = maxEntries;
+        return this;
+    }
+
+    /**
+     * Returns the tracked values, ordered by descending count after {@link #postMerge()}.
+     *
+     * @return The list of entries.
+     */
+    public List<Entry> getEntries() {
+        return entries;
+    }
+
+    public TopKAggregationResult addEntry(ResultNode value, long count, long error) {
+        entries.add(new Entry(value, count, error));
+        return this;
+    }
+
+    @Override
+    public ResultNode getRank() {
+        long maxCount = 0;
+        for (Entry entry : entries) {
+            maxCount = Math.max(maxCount, entry.count);
+        }
+        return new IntegerResultNode(maxCount);
+    }
+
+    @Override
+    protected int onGetClassId() {
+        return classId;
+    }
+
+    @Override
+    protected void onSerialize(Serializer buf) {
+        super.onSerialize(buf);
+        buf.putInt(null, maxEntries);
+        buf.putInt(null, entries.size());
+        for (Entry entry : entries) {
+            serializeOptional(buf, entry.value);
+            buf.putLong(null, entry.count);
+            buf.putLong(null, entry.error);
+        }
+    }
+
+    @Override
+    protected void onDeserialize(Deserializer buf) {
+        super.onDeserialize(buf);
+        maxEntries = buf.getInt(null);
+        int numEntries = buf.getInt(null);
+        entries = new ArrayList<>(numEntries);
+        for (int i = 0; i < numEntries; i++) {
+            ResultNode value = (ResultNode)deserializeOptional(buf);
+            long count = buf.getLong(null);
+            long error = buf.getLong(null);
+            entries.add(new Entry(value, count, error));
+        }
+    }
+
+    private long getMinCount() {
+        if (entries.isEmpty() || entries.size() < maxEntries) {
+            return 0;
+        }
+        long minCount = Long.MAX_VALUE;
+        for (Entry entry : entries) {
+            minCount = Math.min(minCount, entry.count);
+        }
+        return minCount;
+    }
+
+    private Entry find(ResultNode value) {
+        for (Entry entry : entries) {
+            if (entry.hasValue(value)) {
+                return entry;
+            }
+        }
+        return null;
+    }
+
+    @Override
+    protected void onMerge(AggregationResult result) {
+        TopKAggregationResult rhs = (TopKAggregationResult)result;
+        maxEntries = Math.max(maxEntries, rhs.maxEntries);
+        // A value not tracked by one summary may have occurred up to its lowest count times there.
+        long myMin = getMinCount();
+        long otherMin = rhs.getMinCount();
+        List<Entry> merged = new ArrayList<>(entries.size() + rhs.entries.size());
+        List<Entry> unmatched = new ArrayList<>(entries);
+        for (Entry other : rhs.entries) {
+            Entry entry = find(other.value);
+            if (entry != null) {
+                unmatched.remove(entry);
+                merged.add(new Entry(entry.value, entry.count + other.count, entry.error + other.error));
+            } else {
+                merged.add(new Entry(other.value, other.count + myMin, other.error + myMin));
+            }
+        }
+        for (Entry entry : unmatched) {
+            merged.add(new Entry(entry.value, entry.count + otherMin, entry.error + otherMin));
+        }
+        entries = merged;
+        postMerge();
+    }
+
+    @Override
+    public void postMerge() {
+        Collections.sort(entries, (lhs, rhs) -> Long.compare(rhs.count, lhs.count));
+        if (entries.size() > maxEntries) {
+            entries = new ArrayList<>(entries.subList(0, maxEntries));
+        }
+    }
+
+    @Override
+    protected boolean equalsAggregation(AggregationResult obj) {
+        TopKAggregationResult rhs = (TopKAggregationResult)obj;
+        return maxEntries == rhs.maxEntries && entries.equals(rhs.entries);
+    }
+
+    @Override
+    public int hashCode() {
+        return super.hashCode() + maxEntries + entries.hashCode();
+    }
+
+    @Override
+    public TopKAggregationResult clone() {
+        TopKAggregationResult obj = (TopKAggregationResult)super.clone();
+        obj.entries = new ArrayList<>(entries.size());
+        for (Entry entry : entries) {
+            obj.entries.add(new Entry((ResultNode)entry.value.clone(), entry.count, entry.error));
+        }
+        return obj;
+    }
+
+    @Override
+    public void visitMembers(ObjectVisitor visitor) {
+        super.visitMembers(visitor);
+        visitor.visit("maxEntries", maxEntries);
+        visitor.openStruct("entries", "List");
+        for (int i = 0; i < entries.size(); i++) {
+            Entry entry = entries.get(i);
+            visitor.openStruct("[" + i + "]", "Entry");
+            visitor.visit("value", entry.value);
+            visitor.visit("count", entry.count);
+            visitor.visit("error", entry.error);
+            visitor.closeStruct();
+        }
+        visitor.closeStruct();
+    }
+}
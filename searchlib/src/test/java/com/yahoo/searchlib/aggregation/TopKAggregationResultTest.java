@@ -0,0 +1,52 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+package com.yahoo.searchlib.aggregation;
+
+import com.yahoo.searchlib.expression.IntegerResultNode;
+import com.yahoo.searchlib.expression.StringResultNode;
+import com.yahoo.vespa.objects.BufferSerializer;
+import com.yahoo.vespa.objects.Identifiable;
+import org.junit.Test;
+
+import static org.junit.Assert.assertEquals;
+
+public class TopKAggregationResultTest {
+
+    @Test
+    public void rank_is_highest_count() {
+        TopKAggregationResult result = new TopKAggregationResult(2)
+                .addEntry(new IntegerResultNode(1), 3, 0)
+                .addEntry(new IntegerResultNode(2), 5, 0);
+        assertEquals(5, result.getRank().getInteger());
+    }
+
+    @Test
+    public void merge_adds_lowest_count_of_other_summary_for_untracked_values() {
+        TopKAggregationResult lhs = new TopKAggregationResult(2)
+                .addEntry(new IntegerResultNode(1), 5, 0)
+                .addEntry(new IntegerResultNode(2), 3, 0);
+        TopKAggregationResult rhs = new TopKAggregationResult(2)
+                .addEntry(new IntegerResultNode(2), 4, 0)
+                .addEntry(new IntegerResultNode(3), 1, 0);
+        lhs.merge(rhs);
+        assertEquals(2, lhs.getEntries().size());
+        assertEquals(new IntegerResultNode(2), lhs.getEntries().get(0).getValue());
+        assertEquals(7, lhs.getEntries().get(0).getCount());
+        assertEquals(0, lhs.getEntries().get(0).getError());
+        assertEquals(new IntegerResultNode(1), lhs.getEntries().get(1).getValue());
+        assertEquals(6, lhs.getEntries().get(1).getCount());
+        assertEquals(1, lhs.getEntries().get(1).getError());
+    }
+
+    @Test
+    public void serialization_round_trip_preserves_entries() {
+        TopKAggregationResult result = new TopKAggregationResult(4)
+                .addEntry(new IntegerResultNode(1), 5, 0)
+                .addEntry(new StringResultNode("foo"), 2, 1);
+        BufferSerializer buf = new BufferSerializer();
+        result.serializeWithId(buf);
+        buf.flip();
+        TopKAggregationResult copy = (TopKAggregationResult)Identifiable.create(buf);
+        assertEquals(result, copy);
+    }
+
+}
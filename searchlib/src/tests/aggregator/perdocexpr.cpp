@@ -243,6 +243,97 @@ TEST("require that StandardDeviationAggregationResult aggregates multi-value exp
     EXPECT_APPROX(41.5, aggr.getRank().getFloat(), 0.1);
 }
 
+void aggregateTopK(TopKAggregationResult &aggr, int64_t value, uint32_t times) {
+    aggr.setExpression(MU<ConstantNode>(MU<Int64ResultNode>(value)));
+    for (uint32_t i = 0; i < times; ++i) {
+        aggr.aggregate(DocId(i), HitRank(1));
+    }
+}
+
+TEST("require that TopKAggregationResult counts values exactly while there is room") {
+    TopKAggregationResult aggr(3);
+    aggregateTopK(aggr, 7, 5);
+    aggregateTopK(aggr, 8, 2);
+    aggregateTopK(aggr, 9, 3);
+    aggr.postMerge();
+    ASSERT_EQUAL(3u, aggr.getEntries().size());
+    EXPECT_EQUAL(7, aggr.getEntries()[0].getValue().getInteger());
+    EXPECT_EQUAL(5u, aggr.getEntries()[0].getCount());
+    EXPECT_EQUAL(9, aggr.getEntries()[1].getValue().getInteger());
+    EXPECT_EQUAL(3u, aggr.getEntries()[1].getCount());
+    EXPECT_EQUAL(8, aggr.getEntries()[2].getValue().getInteger());
+    EXPECT_EQUAL(0u, aggr.getEntries()[2].getError());
+    EXPECT_EQUAL(5, aggr.getRank().getInteger());
+}
+
+TEST("require that TopKAggregationResult replaces the least frequent value when full") {
+    TopKAggregationResult aggr(2);
+    aggregateTopK(aggr, 1, 4);
+    aggregateTopK(aggr, 2, 1);
+    aggregateTopK(aggr, 3, 2);
+    aggr.postMerge();
+    ASSERT_EQUAL(2u, aggr.getEntries().size());
+    EXPECT_EQUAL(1, aggr.getEntries()[0].getValue().getInteger());
+    EXPECT_EQUAL(4u, aggr.getEntries()[0].getCount());
+    EXPECT_EQUAL(3, aggr.getEntries()[1].getValue().getInteger());
+    EXPECT_EQUAL(3u, aggr.getEntries()[1].getCount());
+    EXPECT_EQUAL(1u, aggr.getEntries()[1].getError());
+}
+
+TEST("require that TopKAggregationResult aggregates multi-value expression correctly") {
+    TopKAggregationResult aggr;
+    aggr.setExpression(createVectorFloat(std::vector<double>({1.5, 2.5, 1.5}))).
+            aggregate(DocId(42), HitRank(21));
+    aggr.postMerge();
+    ASSERT_EQUAL(2u, aggr.getEntries().size());
+    EXPECT_EQUAL(1.5, aggr.getEntries()[0].getValue().getFloat());
+    EXPECT_EQUAL(2u, aggr.getEntries()[0].getCount());
+    EXPECT_EQUAL(2.5, aggr.getEntries()[1].getValue().getFloat());
+    EXPECT_EQUAL(1u, aggr.getEntries()[1].getCount());
+}
+
+TEST("require that TopKAggregationResult can be merged") {
+    TopKAggregationResult aggr1(2);
+    aggregateTopK(aggr1, 1, 5);
+    aggregateTopK(aggr1, 2, 3);
+    TopKAggregationResult aggr2(2);
+    aggregateTopK(aggr2, 2, 4);
+    aggregateTopK(aggr2, 3, 1);
+
+    aggr1.merge(aggr2);
+    ASSERT_EQUAL(2u, aggr1.getEntries().size());
+    EXPECT_EQUAL(2, aggr1.getEntries()[0].getValue().getInteger());
+    EXPECT_EQUAL(7u, aggr1.getEntries()[0].getCount());
+    EXPECT_EQUAL(0u, aggr1.getEntries()[0].getError());
+    EXPECT_EQUAL(1, aggr1.getEntries()[1].getValue().getInteger());
+    EXPECT_EQUAL(6u, aggr1.getEntries()[1].getCount());
+    EXPECT_EQUAL(1u, aggr1.getEntries()[1].getError());
+    EXPECT_EQUAL(7, aggr1.getRank().getInteger());
+}
+
+TEST("require that TopKAggregationResult can be serialized") {
+    TopKAggregationResult aggr1(4);
+    aggregateTopK(aggr1, 1, 5);
+    aggr1.setExpression(MU<ConstantNode>(MU<StringResultNode>("foo"))).aggregate(DocId(1), HitRank(1));
+
+    nbostream os;
+    NBOSerializer nos(os);
+    nos << aggr1;
+    Identifiable::UP obj = Identifiable::create(nos);
+    auto *aggr2 = dynamic_cast<TopKAggregationResult *>(obj.get());
+    ASSERT_TRUE(aggr2);
+    EXPECT_TRUE(os.empty());
+    EXPECT_EQUAL(4u, aggr2->getMaxEntries());
+    ASSERT_EQUAL(2u, aggr2->getEntries().size());
+    EXPECT_EQUAL(1, aggr2->getEntries()[0].getValue().getInteger());
+    EXPECT_EQUAL(5u, aggr2->getEntries()[0].getCount());
+    EXPECT_EQUAL(0, StringResultNode("foo").cmp(aggr2->getEntries()[1].getValue()));
+    EXPECT_EQUAL(1u, aggr2->getEntries()[1].getCount());
+    EXPECT_EQUAL(5, aggr2->getRank().getInteger());
+    aggr2->setExpression(MU<ConstantNode>(MU<StringResultNode>("foo"))).aggregate(DocId(2), HitRank(1));
+    EXPECT_EQUAL(2u, aggr2->getEntries()[1].getCount());
+}
+
 void testAdd(const ResultNode &a, const ResultNode &b, const ResultNode &c) {
     AddFunctionNode func;
     func.appendArg(MU<ConstantNode>(ResultNode::UP(a.clone())))
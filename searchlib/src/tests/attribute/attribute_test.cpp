@@ -19,6 +19,7 @@
 #include <vespa/vespalib/io/fileutil.h>
 #include <vespa/searchlib/attribute/attributevector.hpp>
 #include <cmath>
+#include <fstream>
 #include <iostream>
 
 #include <vespa/log/log.h>
@@ -102,6 +103,21 @@ statSize(const AttributeVector &a)
     return resultSize;
 }
 
+bool
+isDataFileMapped(const AttributeVector &a)
+{
+    vespalib::string suffix = "/" + a.getBaseFileName() + ".dat";
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line)) {
+        if ((line.size() >= suffix.size()) &&
+            (line.compare(line.size() - suffix.size(), suffix.size(), suffix.c_str()) == 0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 
 bool
 preciseEstimatedSize(const AttributeVector &a)
@@ -157,6 +173,9 @@ private:
 
     void testReload();
     void testHasLoadData();
+    template <typename VectorType, typename BufferType>
+    void testMMapLoad(const Config &config);
+    void testMMapLoad();
     void testMemorySaver();
 
     void commit(const AttributePtr & ptr);
@@ -694,6 +713,57 @@ void AttributeTest::testHasLoadData()
     }
 }
 
+template <typename VectorType, typename BufferType>
+void
+AttributeTest::testMMapLoad(const Config &config)
+{
+    vespalib::string name = vespalib::string("mmapload-") + config.basicType().asString();
+    AttributePtr a = createAttribute(name, config);
+    addDocs(a, 1000);
+    populate(static_cast<VectorType &>(*a), 17);
+    EXPECT_TRUE(a->save());
+    AttributePtr copy = createAttribute(name, config);
+    EXPECT_TRUE(copy->load());
+    EXPECT_FALSE(isDataFileMapped(*copy));
+    copy.reset();
+    Config mmapConfig(config);
+    mmapConfig.setMMapLoad(true);
+    AttributePtr b = createAttribute(name, mmapConfig);
+    EXPECT_TRUE(b->load());
+    EXPECT_TRUE(isDataFileMapped(*b));
+    compare<VectorType, BufferType>(static_cast<VectorType &>(*a), static_cast<VectorType &>(*b));
+
+    // Mutate and grow the mapped attribute, the saved file must be unchanged
+    VectorType &bv = static_cast<VectorType &>(*b);
+    EXPECT_TRUE(bv.update(5, 4711));
+    bv.commit();
+    AttributeVector::DocId docId;
+    for (size_t i = 0; i < 3000; ++i) {
+        EXPECT_TRUE(b->addDoc(docId));
+    }
+    EXPECT_TRUE(bv.update(docId, 42));
+    bv.commit();
+    EXPECT_EQUAL(4000u, b->getNumDocs());
+    EXPECT_EQUAL(4711, b->getInt(5));
+    EXPECT_EQUAL(42, b->getInt(docId));
+    EXPECT_EQUAL(a->getInt(6), b->getInt(6));
+    b.reset();
+    EXPECT_FALSE(isDataFileMapped(*a));
+
+    AttributePtr c = createAttribute(name, mmapConfig);
+    EXPECT_TRUE(c->load());
+    EXPECT_TRUE(isDataFileMapped(*c));
+    compare<VectorType, BufferType>(static_cast<VectorType &>(*a), static_cast<VectorType &>(*c));
+}
+
+void
+AttributeTest::testMMapLoad()
+{
+    TEST_DO((testMMapLoad<IntegerAttribute, IntegerAttribute::largeint_t>(Config(BasicType::INT32))));
+    TEST_DO((testMMapLoad<IntegerAttribute, IntegerAttribute::largeint_t>(Config(BasicType::INT64))));
+    TEST_DO((testMMapLoad<FloatingPointAttribute, double>(Config(BasicType::DOUBLE))));
+}
+
 void
 AttributeTest::testMemorySaverInt(const AttributePtr & a, const AttributePtr & b, size_t numDocs)
 {
@@ -2343,6 +2413,7 @@ int AttributeTest::Main()
     testBaseName();
     testReload();
     testHasLoadData();
+    TEST_DO(testMMapLoad());
     testMemorySaver();
 
     testSingle();
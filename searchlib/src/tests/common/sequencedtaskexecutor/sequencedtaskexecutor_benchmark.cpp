@@ -0,0 +1,73 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#include <vespa/log/log.h>
+LOG_SETUP("sequencedtaskexecutor_benchmark");
+#include <vespa/searchlib/common/lockfreesequencedtaskexecutor.h>
+#include <vespa/searchlib/common/sequencedtaskexecutor.h>
+#include <vespa/vespalib/testkit/testapp.h>
+#include <vespa/vespalib/util/benchmark_timer.h>
+
+using namespace search;
+
+namespace {
+
+constexpr uint32_t numThreads = 4;
+constexpr uint32_t numComponents = 50;
+constexpr uint32_t numTasks = 200000;
+
+/**
+ * Schedules small tasks round robin on a number of components, like
+ * the attribute writes triggered by a put to a document type with many
+ * attribute fields.
+ */
+double
+benchmark(ISequencedTaskExecutor &executor, uint32_t taskCost)
+{
+    std::vector<uint64_t> sums(numComponents, 0);
+    std::vector<uint32_t> executorIds;
+    for (uint32_t component = 0; component < numComponents; ++component) {
+        executorIds.push_back(executor.getExecutorId(component));
+    }
+    vespalib::BenchmarkTimer timer(2.0);
+    while (timer.has_budget()) {
+        timer.before();
+        for (uint32_t i = 0; i < numTasks; ++i) {
+            uint32_t component = i % numComponents;
+            uint64_t *sum = &sums[component];
+            executor.executeLambda(executorIds[component], [sum, i, taskCost]() {
+                for (uint32_t j = 0; j < taskCost; ++j) {
+                    *sum += (i ^ j);
+                }
+            });
+        }
+        executor.sync();
+        timer.after();
+    }
+    return numTasks / timer.min_time();
+}
+
+void
+compare(uint32_t taskCost)
+{
+    SequencedTaskExecutor blocking(numThreads);
+    LockFreeSequencedTaskExecutor lockFree(numThreads);
+    double blockingRate = benchmark(blocking, taskCost);
+    double lockFreeRate = benchmark(lockFree, taskCost);
+    fprintf(stderr, "task cost %u: SequencedTaskExecutor %.0f tasks/s, LockFreeSequencedTaskExecutor %.0f tasks/s (%.2fx)\n",
+            taskCost, blockingRate, lockFreeRate, lockFreeRate / blockingRate);
+}
+
+}
+
+TEST("benchmark handoff of empty tasks") {
+    compare(0);
+}
+
+TEST("benchmark handoff of small tasks") {
+    compare(100);
+}
+
+TEST("benchmark handoff of larger tasks") {
+    compare(2000);
+}
+
+TEST_MAIN() { TEST_RUN_ALL(); }
@@ -1,12 +1,15 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 #include <vespa/log/log.h>
 LOG_SETUP("sequencedtaskexecutor_test");
+#include <vespa/searchlib/common/lockfreesequencedtaskexecutor.h>
 #include <vespa/searchlib/common/sequencedtaskexecutor.h>
 #include <vespa/vespalib/testkit/testapp.h>
 #include <vespa/vespalib/test/insertion_operators.h>
 
-#include <mutex>
+#include <atomic>
 #include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace search
 {
@@ -27,6 +30,18 @@ public:
 };
 
 
+class LockFreeFixture
+{
+public:
+    LockFreeSequencedTaskExecutor _threads;
+
+    LockFreeFixture()
+        : _threads(2, 4)
+    {
+    }
+};
+
+
 class TestObj
 {
 public:
@@ -236,6 +251,55 @@ TEST_F("require that executeLambda works", Fixture)
 }
 
 
+TEST_F("require that lock free executor serializes tasks with same component id", LockFreeFixture)
+{
+    std::shared_ptr<TestObj> tv(std::make_shared<TestObj>());
+    EXPECT_EQUAL(0, tv->_val);
+    f._threads.execute(0, [=]() { usleep(2000); tv->modify(0, 14); });
+    f._threads.execute(0, [=]() { tv->modify(14, 42); });
+    tv->wait(2);
+    EXPECT_EQUAL(0,  tv->_fail);
+    EXPECT_EQUAL(42, tv->_val);
+    f._threads.sync();
+    EXPECT_EQUAL(0,  tv->_fail);
+    EXPECT_EQUAL(42, tv->_val);
+}
+
+TEST_F("require that lock free executor runs tasks in order when producer blocks on full queue", LockFreeFixture)
+{
+    std::vector<int> res;
+    for (int i = 0; i < 1000; ++i) {
+        f._threads.execute(0, [&res, i]() { res.push_back(i); });
+    }
+    f._threads.sync();
+    ASSERT_EQUAL(1000u, res.size());
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQUAL(i, res[i]);
+    }
+}
+
+TEST_F("require that lock free executor accepts tasks from multiple producers", LockFreeFixture)
+{
+    LockFreeSequencedTaskExecutor &threads = f._threads;
+    std::atomic<uint32_t> count(0);
+    uint32_t executorId0 = threads.getExecutorId(0);
+    uint32_t executorId1 = threads.getExecutorId(1);
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < 4; ++producer) {
+        uint32_t executorId = (producer % 2 == 0) ? executorId0 : executorId1;
+        producers.emplace_back([&threads, &count, executorId]() {
+            for (uint32_t i = 0; i < 10000; ++i) {
+                threads.executeLambda(executorId, [&count]() { ++count; });
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    threads.sync();
+    EXPECT_EQUAL(40000u, count.load());
+}
+
 }  // namespace common
 }  // namespace search
 
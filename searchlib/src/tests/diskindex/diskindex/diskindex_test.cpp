@@ -15,6 +15,7 @@
 #include <vespa/searchlib/index/dummyfileheadercontext.h>
 #include <vespa/searchlib/test/fakedata/fpfactory.h>
 #include <vespa/vespalib/io/fileutil.h>
+#include <algorithm>
 #include <iostream>
 #include <set>
 
@@ -61,6 +62,7 @@ private:
     void requireThatBlueprintIsCreated();
     void requireThatBlueprintCanCreateSearchIterators();
     void requireThatSearchIteratorsConforms();
+    void requireThatZcPostingSeekMatchesByteWiseDecode();
 public:
     Test();
     ~Test();
@@ -118,6 +120,117 @@ Test::requireThatSearchIteratorsConforms()
     }
 }
 
+namespace {
+
+/**
+ * Docids with runs of docid deltas that are encoded as single bytes,
+ * separated by deltas needing several bytes. The run lengths are
+ * chosen around the block size used when skipping single byte deltas,
+ * and the last run ends the posting list.
+ */
+std::vector<uint32_t>
+makeSingleByteRunDocIds(uint32_t lastRunLength)
+{
+    std::vector<uint32_t> docIds;
+    uint32_t docId = 0;
+    uint32_t delta = 0;
+    std::vector<uint32_t> runLengths = { 9, 1, 7, 8, 15, 16, 17, 23, 64, 129, 5, lastRunLength };
+    for (uint32_t runLength : runLengths) {
+        docId += docIds.empty() ? 1 : 1000;
+        docIds.push_back(docId);
+        for (uint32_t i = 0; i < runLength; ++i) {
+            delta = (delta * 37 + 11) % 128; // visits all single byte deltas
+            docId += delta + 1;
+            docIds.push_back(docId);
+        }
+    }
+    return docIds;
+}
+
+uint32_t
+expectedSeek(const std::vector<uint32_t> &docIds, uint32_t docId)
+{
+    auto itr = std::lower_bound(docIds.begin(), docIds.end(), docId);
+    return (itr != docIds.end()) ? *itr : search::endDocId;
+}
+
+uint32_t
+seekResult(SearchIterator &it, uint32_t docId)
+{
+    it.seek(docId);
+    return it.isAtEnd() ? search::endDocId : it.getDocId();
+}
+
+}
+
+void
+Test::requireThatZcPostingSeekMatchesByteWiseDecode()
+{
+    Schema schema;
+    schema.addIndexField(Schema::IndexField("a", Schema::DataType::STRING));
+    bitcompression::PosOccFieldsParams params;
+    params.setSchemaParams(schema, 0);
+    for (uint32_t lastRunLength : { 7u, 8u, 9u }) {
+        std::vector<uint32_t> docIds = makeSingleByteRunDocIds(lastRunLength);
+        uint32_t docIdLimit = docIds.back() + 100;
+        FakeWord fw(docIdLimit, docIds, "a", params, 0);
+        std::vector<const FakeWord *> v;
+        v.push_back(&fw);
+        // Reference decoding one docid delta at a time, without skipping blocks
+        std::unique_ptr<FPFactory> refFactory(getFPFactory("ZcFilterOcc", schema));
+        refFactory->setup(v);
+        FakePosting::SP ref(refFactory->make(fw));
+        for (const char *postingType : { "ZcSkipPosOccBE", "ZcSkipPosOccLE", "Zc2SkipPosOccBE", "Zc2SkipPosOccLE" }) {
+            std::unique_ptr<FPFactory> ff(getFPFactory(postingType, schema));
+            ff->setup(v);
+            FakePosting::SP f(ff->make(fw));
+            TermFieldMatchData md;
+            TermFieldMatchDataArray tfmda;
+            tfmda.add(&md);
+            // Seek into every gap and onto every docid, also past the last one
+            size_t failures = 0;
+            for (uint32_t docId = 1; docId < docIdLimit; ++docId) {
+                std::unique_ptr<SearchIterator> it(f->createIterator(tfmda));
+                std::unique_ptr<SearchIterator> refIt(ref->createIterator(tfmda));
+                it->initFullRange();
+                refIt->initFullRange();
+                uint32_t expected = expectedSeek(docIds, docId);
+                uint32_t refResult = seekResult(*refIt, docId);
+                uint32_t result = seekResult(*it, docId);
+                if ((refResult != expected) || (result != expected)) {
+                    ++failures;
+                }
+            }
+            EXPECT_EQUAL(0u, failures);
+            // Seek forwards across runs with different distances
+            for (uint32_t step : { 1u, 2u, 7u, 8u, 9u, 100u, 1000u }) {
+                std::unique_ptr<SearchIterator> it(f->createIterator(tfmda));
+                std::unique_ptr<SearchIterator> refIt(ref->createIterator(tfmda));
+                it->initFullRange();
+                refIt->initFullRange();
+                failures = 0;
+                for (uint32_t docId = 1; docId < docIdLimit; docId += step) {
+                    uint32_t refResult = seekResult(*refIt, docId);
+                    uint32_t result = seekResult(*it, docId);
+                    if ((refResult != expectedSeek(docIds, docId)) || (result != refResult)) {
+                        ++failures;
+                    }
+                    if (result == search::endDocId) {
+                        break;
+                    }
+                    docId = result;
+                }
+                EXPECT_EQUAL(0u, failures);
+            }
+            // Features must still be in sync when skipping hits between unpacks
+            for (uint32_t stride : { 1u, 2u, 8u, 9u, 17u, 65u }) {
+                std::unique_ptr<SearchIterator> it(f->createIterator(tfmda));
+                EXPECT_TRUE(fw.validate(it.get(), tfmda, stride, false));
+            }
+        }
+    }
+}
+
 void
 Test::requireThatLookupIsWorking(bool fieldEmpty,
                                  bool docEmpty,
@@ -338,6 +451,7 @@ Test::Main()
     TEST_DO(requireThatBlueprintIsCreated());
     TEST_DO(requireThatBlueprintCanCreateSearchIterators());
     TEST_DO(requireThatSearchIteratorsConforms());
+    TEST_DO(requireThatZcPostingSeekMatchesByteWiseDecode());
 
     TEST_DONE();
 }
@@ -445,6 +445,25 @@ Test::requireThatFusionIsWorking(const vespalib::string &prefix,
             break;
         TEST_DO(validateDiskIndex(dw3, true, true));
     } while (0);
+    do {
+        std::vector<vespalib::string> sources;
+        SelectorArray selector(numDocs, 0);
+        sources.push_back(prefix + "dump2");
+        if (!EXPECT_TRUE(Fusion::merge(schema,
+                                       prefix + "dump7",
+                                       sources, selector,
+                                       dynamicKPosOcc,
+                                       tuneFileIndexing,
+                                       fileHeaderContext,
+                                       4)))
+            return;
+    } while (0);
+    do {
+        DiskIndex dw7(prefix + "dump7");
+        if (!EXPECT_TRUE(dw7.setup(tuneFileSearch)))
+            break;
+        TEST_DO(validateDiskIndex(dw7, true, true));
+    } while (0);
 }
 
 Test::Test()
@@ -2,7 +2,13 @@
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/searchlib/docstore/documentstore.h>
 #include <vespa/searchlib/docstore/cachestats.h>
+#include <vespa/document/repo/configbuilder.h>
 #include <vespa/document/repo/documenttyperepo.h>
+#include <vespa/document/datatype/documenttype.h>
+#include <vespa/document/fieldvalue/document.h>
+#include <vespa/vespalib/stllike/asciistream.h>
+#include <vespa/vespalib/stllike/hash_map.h>
+#include <vespa/vespalib/data/databuffer.h>
 
 using namespace search;
 
@@ -42,6 +48,46 @@ struct NullDataStore : IDataStore {
     virtual void shrinkLidSpace() override {}
 };
 
+struct MapDataStore : NullDataStore {
+    vespalib::hash_map<uint32_t, vespalib::string> _docs;
+    MapDataStore() : NullDataStore(), _docs() {}
+    ssize_t read(uint32_t lid, vespalib::DataBuffer &buffer) const override {
+        auto found = _docs.find(lid);
+        if (found == _docs.end()) {
+            return 0;
+        }
+        buffer.writeBytes(found->second.data(), found->second.size());
+        return found->second.size();
+    }
+    void write(uint64_t, uint32_t lid, const void *buffer, size_t len) override {
+        _docs[lid] = vespalib::string(static_cast<const char *>(buffer), len);
+    }
+};
+
+document::DocumenttypesConfig
+makeDocTypeRepoConfig()
+{
+    document::config_builder::DocumenttypesConfigBuilderHelper builder;
+    builder.document(787121340, "test",
+                     document::config_builder::Struct("test.header"),
+                     document::config_builder::Struct("test.body").
+                     addField("main", document::DataType::T_STRING));
+    return builder.config();
+}
+
+document::Document::UP
+makeDoc(const document::DocumentTypeRepo &docRepo, uint32_t i)
+{
+    vespalib::asciistream idstr;
+    idstr << "id:test:test::" << i;
+    const document::DocumentType *docType = docRepo.getDocumentType("test");
+    auto doc = std::make_unique<document::Document>(*docType, document::DocumentId(idstr.str()));
+    vespalib::asciistream mainstr;
+    mainstr << "static text " << i << " body something and end field";
+    doc->set("main", mainstr.c_str());
+    return doc;
+}
+
 TEST_FFF("require that uncache docstore lookups are counted",
          DocumentStore::Config(document::CompressionConfig::NONE, 0, 0),
          NullDataStore(), DocumentStore(f1, f2))
@@ -60,4 +106,55 @@ TEST_FFF("require that cached docstore lookups are counted",
     EXPECT_EQUAL(1u, f3.getCacheStats().misses);
 }
 
+TEST("require that cache probation percent is capped below 100") {
+    DocumentStore::Config config(document::CompressionConfig::NONE, 100000, 100);
+    EXPECT_EQUAL(0u, config.getCacheProbationPercent());
+    EXPECT_EQUAL(20u, config.cacheProbationPercent(20).getCacheProbationPercent());
+    EXPECT_EQUAL(90u, config.cacheProbationPercent(100).getCacheProbationPercent());
+    EXPECT_EQUAL(90u, config.cacheProbationPercent(150).getCacheProbationPercent());
+}
+
+struct SegmentedCacheConfig : DocumentStore::Config {
+    SegmentedCacheConfig()
+        : DocumentStore::Config(document::CompressionConfig::NONE, 100000, 100)
+    {
+        cacheProbationPercent(20);
+    }
+};
+
+TEST_FFF("require that segmented cache promotes documents read twice",
+         SegmentedCacheConfig(), MapDataStore(), DocumentStore(f1, f2))
+{
+    document::DocumentTypeRepo docRepo(makeDocTypeRepoConfig());
+    const uint32_t numDocs = 1000;
+    for (uint32_t lid = 1; lid <= numDocs; ++lid) {
+        f3.write(lid, lid, *makeDoc(docRepo, lid));
+    }
+    EXPECT_TRUE(f3.read(1, docRepo).get() != nullptr);
+    CacheStats stats = f3.getCacheStats();
+    EXPECT_EQUAL(0u, stats.hits);
+    EXPECT_EQUAL(1u, stats.misses);
+    EXPECT_EQUAL(1u, stats.elements);
+
+    document::Document::UP doc = f3.read(1, docRepo);
+    ASSERT_TRUE(doc.get() != nullptr);
+    EXPECT_TRUE(*makeDoc(docRepo, 1) == *doc);
+    stats = f3.getCacheStats();
+    EXPECT_EQUAL(1u, stats.hits);
+    EXPECT_EQUAL(1u, stats.misses);
+    EXPECT_EQUAL(1u, stats.elements);
+
+    // A scan reading every document once only evicts from the probation segment.
+    for (uint32_t lid = 2; lid <= numDocs; ++lid) {
+        EXPECT_TRUE(f3.read(lid, docRepo).get() != nullptr);
+    }
+    stats = f3.getCacheStats();
+    EXPECT_EQUAL(1u, stats.hits);
+    EXPECT_EQUAL(numDocs, stats.misses);
+    EXPECT_GREATER(stats.evictions, 0u);
+    EXPECT_LESS(stats.elements, numDocs);
+    EXPECT_TRUE(f3.read(1, docRepo).get() != nullptr);
+    EXPECT_EQUAL(2u, f3.getCacheStats().hits);
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
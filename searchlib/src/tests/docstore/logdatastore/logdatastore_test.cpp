@@ -923,6 +923,89 @@ TEST("require that lid space can be compacted and entries from old files skipped
     }
 }
 
+struct BufferCollector : public IBufferVisitor {
+    std::map<uint32_t, vespalib::string> buffers;
+    void visit(uint32_t lid, vespalib::ConstBufferRef buf) override {
+        buffers[lid] = vespalib::string(buf.c_str(), buf.size());
+    }
+};
+
+TEST("require that prefetch of lids spread over several files does not affect what is read")
+{
+    Fixture f("tmp");
+    f.write(10);
+    f.writeUntilNewChunk(100);
+    f.write(20);
+    f.writeUntilNewChunk(200);
+    f.write(30);
+    f.flush();
+    IDataStore::LidVector lids = {30, 10, 5, 100, 20, 201, 1000};
+    f.store.prefetch(lids);
+    f.store.prefetch(IDataStore::LidVector());
+    BufferCollector collector;
+    f.store.read(lids, collector);
+    EXPECT_EQUAL(5u, collector.buffers.size());
+    for (const auto &entry : collector.buffers) {
+        EXPECT_EQUAL(genData(entry.first, 1024), entry.second);
+    }
+    TEST_DO(f.assertContent({10,100,101,102,20,200,201,202,30}, 203));
+}
+
+vespalib::string
+genDocument(uint32_t lid)
+{
+    vespalib::asciistream os;
+    os << "{\"id\":\"id:test:music::" << lid << "\",\"title\":\"Title number " << (lid * 7919) % 1013
+       << "\",\"artist\":\"Artist " << lid % 97 << "\",\"year\":" << 1950 + lid % 70
+       << ",\"genre\":\"" << ((lid % 3 == 0) ? "rock" : "jazz") << "\"}";
+    return os.str();
+}
+
+size_t
+countDictFiles(const vespalib::string & dir)
+{
+    size_t count(0);
+    FastOS_DirectoryScan dirScan(dir.c_str());
+    while (dirScan.ReadNext()) {
+        vespalib::stringref file(dirScan.GetName());
+        if (dirScan.IsRegular() && (file.size() > 5) && (file.substr(file.size() - 5) == ".dict")) {
+            count++;
+        }
+    }
+    return count;
+}
+
+TEST("require that chunks compressed with a trained dictionary can be read after restart")
+{
+    vespalib::ThreadStackExecutor executor(1, 0x10000);
+    search::test::DirectoryHandler dir("tmp");
+    DummyFileHeaderContext fileHeaderContext;
+    MyTlSyncer tlSyncer;
+    LogDataStore::Config config(20000, 0.2, 2.5, 0.2, 1, true, CompressionConfig::LZ4,
+                                WriteableFileChunk::Config(CompressionConfig(CompressionConfig::ZSTD, 3, 90), 1000));
+    config.setCompressionDictionarySize(1024);
+    const uint32_t numDocs = 10000;
+    {
+        LogDataStore store(executor, "tmp", config, GrowStrategy(), TuneFileSummary(), fileHeaderContext, tlSyncer, nullptr);
+        for (uint32_t lid = 1; lid < numDocs; ++lid) {
+            vespalib::string doc = genDocument(lid);
+            store.write(lid, lid, doc.c_str(), doc.size());
+        }
+        store.initFlush(numDocs);
+        store.flush(numDocs);
+        EXPECT_GREATER(store.getFileChunkStats().size(), 2u);
+    }
+    EXPECT_GREATER(countDictFiles("tmp"), 0u);
+    {
+        LogDataStore store(executor, "tmp", config, GrowStrategy(), TuneFileSummary(), fileHeaderContext, tlSyncer, nullptr);
+        for (uint32_t lid = 1; lid < numDocs; ++lid) {
+            vespalib::DataBuffer buffer;
+            store.read(lid, buffer);
+            EXPECT_EQUAL(genDocument(lid), vespalib::string(buffer.getData(), buffer.getDataLen()));
+        }
+    }
+}
+
 TEST_F("require that getLid() is protected by docIdLimit", Fixture)
 {
     f.write(1);
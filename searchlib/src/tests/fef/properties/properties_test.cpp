@@ -295,6 +295,22 @@ TEST("test stuff") {
             p.add("vespa.matching.numsearchpartitions", "50");
             EXPECT_EQUAL(matching::NumSearchPartitions::lookup(p), 50u);
         }
+        { // vespa.matching.workstealing.chunksperthread
+            EXPECT_EQUAL(matching::WorkStealingChunksPerThread::NAME, vespalib::string("vespa.matching.workstealing.chunksperthread"));
+            EXPECT_EQUAL(matching::WorkStealingChunksPerThread::DEFAULT_VALUE, 0u);
+            Properties p;
+            EXPECT_EQUAL(matching::WorkStealingChunksPerThread::lookup(p), 0u);
+            p.add("vespa.matching.workstealing.chunksperthread", "64");
+            EXPECT_EQUAL(matching::WorkStealingChunksPerThread::lookup(p), 64u);
+        }
+        { // vespa.matching.workstealing.numnodes
+            EXPECT_EQUAL(matching::WorkStealingNumNodes::NAME, vespalib::string("vespa.matching.workstealing.numnodes"));
+            EXPECT_EQUAL(matching::WorkStealingNumNodes::DEFAULT_VALUE, 1u);
+            Properties p;
+            EXPECT_EQUAL(matching::WorkStealingNumNodes::lookup(p), 1u);
+            p.add("vespa.matching.workstealing.numnodes", "2");
+            EXPECT_EQUAL(matching::WorkStealingNumNodes::lookup(p), 2u);
+        }
         { // vespa.matchphase.degradation.attribute
             EXPECT_EQUAL(matchphase::DegradationAttribute::NAME, vespalib::string("vespa.matchphase.degradation.attribute"));
             EXPECT_EQUAL(matchphase::DegradationAttribute::DEFAULT_VALUE, "");
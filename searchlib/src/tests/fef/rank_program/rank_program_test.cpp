@@ -124,6 +124,10 @@ struct Fixture {
         }
         return 31212.0;
     }
+    std::vector<double> get_batch(const std::vector<uint32_t> &docids) {
+        auto result = program.execute_batch(docids);
+        return std::vector<double>(result.begin(), result.end());
+    }
     std::map<vespalib::string, double> all(uint32_t docid = default_docid) {
         auto result = program.get_seeds();
         std::map<vespalib::string, double> result_map;
@@ -357,4 +361,44 @@ TEST_F("require that interpreted ranking expressions are pure", Fixture()) {
     EXPECT_EQUAL(f1.get(), 7.0);
 }
 
+TEST_F("require that compiled ranking expressions can be calculated in batches", Fixture()) {
+    f1.add_expr("rank", "docid*2+value(3)").compile();
+    EXPECT_TRUE(f1.program.prepare_batch());
+    EXPECT_TRUE(f1.get_batch({1, 5, 7}) == std::vector<double>({5.0, 13.0, 17.0}));
+    EXPECT_TRUE(f1.get_batch({2}) == std::vector<double>({7.0}));
+}
+
+TEST_F("require that lazy compiled ranking expressions can be calculated in batches", Fixture()) {
+    f1.lazy_expressions(true).add_expr("rank", "if(docid<5,docid,value(10))").compile();
+    EXPECT_TRUE(f1.program.prepare_batch());
+    EXPECT_TRUE(f1.get_batch({1, 4, 5, 9}) == std::vector<double>({1.0, 4.0, 10.0, 10.0}));
+}
+
+TEST_F("require that batch calculation does not leave stale values for single documents", Fixture()) {
+    f1.add_expr("rank", "docid*2").compile();
+    EXPECT_TRUE(f1.program.prepare_batch());
+    EXPECT_EQUAL(14.0, f1.get(7));
+    EXPECT_TRUE(f1.get_batch({3}) == std::vector<double>({6.0}));
+    EXPECT_EQUAL(14.0, f1.get(7));
+}
+
+TEST_F("require that const seeds can be calculated in batches", Fixture()) {
+    f1.add("value(10)").compile();
+    EXPECT_TRUE(f1.program.prepare_batch());
+    EXPECT_TRUE(f1.get_batch({1, 2}) == std::vector<double>({10.0, 10.0}));
+}
+
+TEST_F("require that batch calculation needs batch support in all non-const executors", Fixture()) {
+    f1.add_expr("rank", "docid+ivalue(5)").compile();
+    EXPECT_FALSE(f1.program.prepare_batch());
+}
+
+TEST_F("require that batch calculation needs a single number seed", Fixture()) {
+    f1.add("docid").add("value(10)").compile();
+    EXPECT_FALSE(f1.program.prepare_batch());
+    Fixture f2;
+    f2.add("box(docid)").compile();
+    EXPECT_FALSE(f2.program.prepare_batch());
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
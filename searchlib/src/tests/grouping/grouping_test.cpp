@@ -5,9 +5,12 @@
 #include <vespa/searchlib/aggregation/aggregation.h>
 #include <vespa/searchlib/attribute/extendableattributes.h>
 #include <vespa/searchlib/attribute/attributemanager.h>
+#include <vespa/searchlib/attribute/attributefactory.h>
+#include <vespa/searchlib/attribute/stringbase.h>
 #include <vespa/searchlib/aggregation/hitsaggregationresult.h>
 #include <vespa/searchlib/aggregation/fs4hit.h>
 #include <vespa/searchlib/aggregation/predicates.h>
+#include <vespa/searchlib/aggregation/columnargrouping.h>
 #include <vespa/searchlib/expression/fixedwidthbucketfunctionnode.h>
 #include <algorithm>
 #include <cmath>
@@ -154,6 +157,7 @@ public:
     void testPruneComplex();
     void testPartialMerging();
     void testCount();
+    void testColumnarGrouping();
     void testTopN();
     void testFS4HitCollection();
     bool checkBucket(const NumericResultNode &width, const NumericResultNode &value, const BucketResultNode &bucket);
@@ -1632,6 +1636,67 @@ Test::testCount()
     EXPECT_TRUE(testAggregation(ctx, request, expect));
 }
 
+/**
+ * Verify that the columnar fast path produces the same group tree as
+ * aggregating one hit at a time, both when the group keys are dense
+ * and when they are too sparse to be aggregated into dense arrays, and
+ * when grouping on the enum handles of a string attribute.
+ **/
+void
+Test::testColumnarGrouping()
+{
+    AggregationContext ctx;
+    IntAttrBuilder dense("dense");
+    IntAttrBuilder sparse("sparse");
+    FloatAttrBuilder value("value");
+    AttributeVector::SP strAttr = AttributeFactory::createAttribute("string", Config(BasicType::STRING, CollectionType::SINGLE));
+    strAttr->addDocs(1000);
+    for (uint32_t docid = 0; docid < 1000; ++docid) {
+        dense.add(docid % 37);
+        sparse.add(int64_t(docid % 37) << 40);
+        value.add(docid * 0.25);
+        static_cast<StringAttribute &>(*strAttr).update(docid, make_string("key%u", docid % 37));
+        ctx.result().add(docid, (docid * 7) % 101);
+    }
+    strAttr->commit();
+    ASSERT_TRUE(strAttr->hasEnum());
+    ctx.add(dense.sp());
+    ctx.add(sparse.sp());
+    ctx.add(value.sp());
+    ctx.add(strAttr);
+
+    // group key and the attribute averaged per group
+    std::vector<std::pair<const char *, const char *>> requests =
+        {{"dense", "dense"}, {"sparse", "sparse"}, {"string", "value"}};
+    for (const auto &keyAndAverage : requests) {
+        const char *key = keyAndAverage.first;
+        for (int64_t maxGroups : {-1, 5}) {
+            GroupingLevel level;
+            level.setMaxGroups(maxGroups).setExpression(MU<AttributeNode>(key));
+            level.addResult(CountAggregationResult().setExpression(MU<AttributeNode>(key)))
+                 .addResult(SumAggregationResult().setExpression(MU<AttributeNode>("value")))
+                 .addResult(AverageAggregationResult().setExpression(MU<AttributeNode>(keyAndAverage.second)));
+            Grouping request;
+            request.setFirstLevel(0)
+                   .setLastLevel(1)
+                   .setRoot(Group().addResult(CountAggregationResult().setExpression(MU<AttributeNode>(key)))
+                                   .addResult(SumAggregationResult().setExpression(MU<AttributeNode>("value"))))
+                   .addLevel(std::move(level));
+
+            Grouping columnar = request;
+            Grouping classic = request;
+            classic.setColumnar(false);
+            ctx.setup(columnar);
+            ctx.setup(classic);
+            EXPECT_TRUE(ColumnarGrouping(columnar).valid());
+            columnar.aggregate(ctx.result().hits(), ctx.result().size());
+            classic.aggregate(ctx.result().hits(), ctx.result().size());
+            EXPECT_EQUAL((maxGroups < 0) ? 37u : 5u, columnar.getRoot().getChildrenSize());
+            EXPECT_EQUAL(classic.getRoot().asString(), columnar.getRoot().asString());
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 bool
@@ -1910,6 +1975,7 @@ Test::Main()
     testFS4HitCollection();
     testFixedWidthBuckets();
     testCount();
+    testColumnarGrouping();
     testTopN();
     testThatNanIsConverted();
     testNanSorting();
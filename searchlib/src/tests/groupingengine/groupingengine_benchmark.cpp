@@ -135,7 +135,9 @@ AggregationContext::~AggregationContext() {}
 class Test : public TestApp
 {
 public:
+    Test() : _useColumnar(false) { }
 private:
+    bool _useColumnar;
     bool testAggregation(AggregationContext &ctx, const Grouping &request, bool useEngine);
     void benchmarkIntegerSum(bool useEngine, size_t numDocs, size_t numQueries, int64_t maxGroups);
     void benchmarkIntegerCount(bool useEngine, size_t numDocs, size_t numQueries, int64_t maxGroups);
@@ -171,6 +173,7 @@ Test::testAggregation(AggregationContext &ctx, const Grouping &request, bool use
         engine.aggregate(ctx.result().hits(), ctx.result().size());
         Group::UP result = engine.createResult();
     } else {
+        tmp.setColumnar(_useColumnar);
         tmp.aggregate(ctx.result().hits(), ctx.result().size());
     }
     tmp.cleanupAttributeReferences();
@@ -250,7 +253,8 @@ Test::Main()
     vespalib::string idType = "int";
     vespalib::string aggrType = "sum";
     if (_argc > 1) {
-        useEngine = (strcmp(_argv[1], "tree") != 0);
+        _useColumnar = (strcmp(_argv[1], "columnar") == 0);
+        useEngine = (strcmp(_argv[1], "tree") != 0) && !_useColumnar;
     }
     if (_argc > 2) {
         idType = _argv[2];
@@ -324,6 +324,28 @@ TEST_F("require that multiple words at same position works", Fixture)
                  f._inserter.toStr());
 }
 
+TEST_F("require that partitions of a field are merged by word and docId", Fixture)
+{
+    FieldInverter part1(f._schema, 0);
+    vespalib::stringref fieldName = f._schema.getIndexField(0).getName();
+    f._inverters[0]->remove("c", 9);
+    f._inverters[0]->invertField(10, makeDoc10(f._b)->getValue(fieldName));
+    part1.invertField(11, makeDoc11(f._b)->getValue(fieldName));
+    part1.remove("d", 13);
+    std::vector<FieldInverter *> inverters({ f._inverters[0].get(), &part1 });
+    for (auto inverter : inverters) {
+        inverter->sortDocuments();
+    }
+    FieldInverter::mergeDocuments(inverters, f._inserter);
+    EXPECT_EQUAL("f=0,w=a,a=10,a=11,"
+                 "w=b,a=10,a=11,"
+                 "w=c,r=9,a=10,"
+                 "w=d,a=10,r=13,"
+                 "w=e,a=11,"
+                 "w=f,a=11",
+                 f._inserter.toStr());
+}
+
 
 } // namespace memoryindex
 } // namespace search
@@ -54,7 +54,7 @@ struct Index {
     uint32_t     docid;
     std::string  currentField;
 
-    Index(const Setup &setup);
+    Index(const Setup &setup, uint32_t numFieldPartitions = 1);
     ~Index();
     void closeField() {
         if (!currentField.empty()) {
@@ -84,10 +84,14 @@ struct Index {
                       makeLambdaTask([&]() { gate.countDown(); })));
         gate.await();
     }
-    Document::UP commit() {
+    Document::UP insert() {
         closeField();
         Document::UP d = builder.endDocument();
         index.insertDocument(docid, *d);
+        return d;
+    }
+    Document::UP commit() {
+        Document::UP d = insert();
         internalSyncCommit();
         return d;
     }
@@ -103,12 +107,12 @@ private:
 };
 
 
-Index::Index(const Setup &setup)
+Index::Index(const Setup &setup, uint32_t numFieldPartitions)
     : schema(setup.schema),
       _executor(1, 128 * 1024),
       _invertThreads(2),
       _pushThreads(2),
-      index(schema, _invertThreads, _pushThreads),
+      index(schema, _invertThreads, _pushThreads, numFieldPartitions),
       builder(schema),
       docid(1),
       currentField()
@@ -284,6 +288,55 @@ TEST("require that documents can be removed and updated")
                             index.index, title, makeTerm(foo)));
 }
 
+// tests that documents inverted in different field partitions are
+// merged into the same posting lists, with removes applied to all
+// partitions.
+TEST("require that field partitions are merged when pushed")
+{
+    Index index(Setup().field(title), 3);
+    for (uint32_t id = 1; id <= 7; ++id) {
+        index.doc(id).field(title);
+        if (id % 2 == 0) {
+            index.add(bar);
+        }
+        index.add(foo).insert();
+    }
+    index.internalSyncCommit();
+
+    EXPECT_TRUE(verifyResult(FakeResult()
+                            .doc(1).len(1).pos(0)
+                            .doc(2).len(2).pos(1)
+                            .doc(3).len(1).pos(0)
+                            .doc(4).len(2).pos(1)
+                            .doc(5).len(1).pos(0)
+                            .doc(6).len(2).pos(1)
+                            .doc(7).len(1).pos(0),
+                            index.index, title, makeTerm(foo)));
+    EXPECT_TRUE(verifyResult(FakeResult()
+                            .doc(2).len(2).pos(0)
+                            .doc(4).len(2).pos(0)
+                            .doc(6).len(2).pos(0),
+                            index.index, title, makeTerm(bar)));
+
+    // remove and update documents in different partitions
+    index.index.removeDocument(4);
+    index.doc(5).field(title).add(bar).insert();
+    index.internalSyncCommit();
+
+    EXPECT_TRUE(verifyResult(FakeResult()
+                            .doc(1).len(1).pos(0)
+                            .doc(2).len(2).pos(1)
+                            .doc(3).len(1).pos(0)
+                            .doc(6).len(2).pos(1)
+                            .doc(7).len(1).pos(0),
+                            index.index, title, makeTerm(foo)));
+    EXPECT_TRUE(verifyResult(FakeResult()
+                            .doc(2).len(2).pos(0)
+                            .doc(5).len(1).pos(0)
+                            .doc(6).len(2).pos(0),
+                            index.index, title, makeTerm(bar)));
+}
+
 // test the fake field source here, to make sure it acts similar to
 // the memory index field source.
 TEST("testFakeSearchable")
@@ -353,6 +406,87 @@ TEST("requireThatFrozenIndexIgnoresUpdates")
     EXPECT_TRUE(verifyResult(ffr, index.index, title, makeTerm(foo)));
 }
 
+TEST("require that bulk load defers pushing documents")
+{
+    Index index(Setup().field(title));
+    index.index.setBulkLoad(3);
+    vespalib::Gate gate;
+    index.doc(1).field(title).add(foo).insert();
+    index.index.commit(std::make_shared<ScheduleTaskCallback>
+                       (index._executor,
+                        makeLambdaTask([&]() { gate.countDown(); })));
+    index.doc(2).field(title).add(foo).add(foo).insert();
+    index.index.commit(std::shared_ptr<search::IDestructorCallback>());
+    index._pushThreads.sync();
+    index._executor.sync();
+    EXPECT_EQUAL(1u, gate.getCount());
+    EXPECT_TRUE(verifyResult(FakeResult(), index.index, title, makeTerm(foo)));
+    index.doc(3).field(title).add(foo).add(foo).add(foo).commit();
+    gate.await();
+    EXPECT_TRUE(verifyResult(FakeResult()
+                            .doc(1).len(1).pos(0)
+                            .doc(2).len(2).pos(0).pos(1)
+                            .doc(3).len(3).pos(0).pos(1).pos(2),
+                            index.index, title, makeTerm(foo)));
+    index.doc(4).field(title).add(foo).insert();
+    index.index.commit(std::shared_ptr<search::IDestructorCallback>());
+    EXPECT_TRUE(verifyResult(FakeResult()
+                            .doc(1).len(1).pos(0)
+                            .doc(2).len(2).pos(0).pos(1)
+                            .doc(3).len(3).pos(0).pos(1).pos(2),
+                            index.index, title, makeTerm(foo)));
+    index.index.freeze();
+    EXPECT_TRUE(verifyResult(FakeResult()
+                            .doc(1).len(1).pos(0)
+                            .doc(2).len(2).pos(0).pos(1)
+                            .doc(3).len(3).pos(0).pos(1).pos(2)
+                            .doc(4).len(1).pos(0),
+                            index.index, title, makeTerm(foo)));
+}
+
+TEST("require that bulk load bounds number of deferred commits")
+{
+    Index index(Setup().field(title));
+    index.index.setBulkLoad(3);
+    vespalib::CountDownLatch latch(3);
+    index.doc(1).field(title).add(foo).insert();
+    for (uint32_t i = 0; i < 3; ++i) {
+        index.index.commit(std::make_shared<ScheduleTaskCallback>
+                           (index._executor,
+                            makeLambdaTask([&]() { latch.countDown(); })));
+    }
+    index._pushThreads.sync();
+    index._executor.sync();
+    EXPECT_EQUAL(3u, latch.getCount());
+    EXPECT_TRUE(verifyResult(FakeResult(), index.index, title, makeTerm(foo)));
+    index.internalSyncCommit();
+    index._executor.sync();
+    EXPECT_EQUAL(0u, latch.getCount());
+    EXPECT_TRUE(verifyResult(FakeResult()
+                            .doc(1).len(1).pos(0),
+                            index.index, title, makeTerm(foo)));
+}
+
+TEST("require that turning off bulk load pushes deferred documents")
+{
+    Index index(Setup().field(title));
+    index.index.setBulkLoad(3);
+    vespalib::Gate gate;
+    index.doc(1).field(title).add(foo).insert();
+    index.index.commit(std::make_shared<ScheduleTaskCallback>
+                       (index._executor,
+                        makeLambdaTask([&]() { gate.countDown(); })));
+    index._pushThreads.sync();
+    index._executor.sync();
+    EXPECT_EQUAL(1u, gate.getCount());
+    index.index.setBulkLoad(0);
+    EXPECT_FALSE(index.index.isBulkLoad());
+    gate.await();
+    EXPECT_TRUE(verifyResult(FakeResult()
+                            .doc(1).len(1).pos(0),
+                            index.index, title, makeTerm(foo)));
+}
+
 TEST("requireThatNumDocsAndDocIdLimitIsReturned")
 {
     Index index(Setup().field(title));
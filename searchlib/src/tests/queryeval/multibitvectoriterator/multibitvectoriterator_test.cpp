@@ -27,6 +27,7 @@ public:
     void testOr();
     void testAndWith();
     void testEndGuard();
+    void testSparseIntersection();
     template<typename T>
     void testThatOptimizePreservesUnpack();
     template <typename T>
@@ -126,6 +127,43 @@ Test::testAndWith()
     }
 }
 
+void
+Test::testSparseIntersection()
+{
+    // Hits common to all vectors are far apart, forcing strict seeks to skip
+    // several combined blocks of empty words.
+    const uint32_t docIdLimit(100000);
+    const std::vector<uint32_t> common({ 3, 64, 4095, 4096, 4097, 30001, 70000, 99999 });
+    std::vector<BitVector::UP> bvs;
+    for (size_t i(0); i < 5; i++) {
+        bvs.push_back(BitVector::create(docIdLimit));
+        BitVector & bv(*bvs.back());
+        for (uint32_t docId(i + 1); docId < docIdLimit; docId += 5) {
+            bv.setBit(docId);
+        }
+        for (uint32_t docId : common) {
+            bv.setBit(docId);
+        }
+        bv.invalidateCachedCount();
+    }
+    TermFieldMatchData tfmd;
+    TermFieldMatchDataArray tfmda;
+    tfmda.add(&tfmd);
+    for (bool strict : {false, true}) {
+        MultiSearch::Children children;
+        for (const auto & bv : bvs) {
+            children.push_back(BitVectorIterator::create(bv.get(), tfmda, strict).release());
+        }
+        SearchIterator::UP s(AndSearch::create(children, strict));
+        s = MultiBitVectorIteratorBase::optimize(std::move(s));
+        H hits = seek(*s, docIdLimit);
+        ASSERT_EQUAL(common.size(), hits.size());
+        for (size_t i(0); i < hits.size(); i++) {
+            EXPECT_EQUAL(common[i], hits[i]);
+        }
+    }
+}
+
 void
 Test::testAndNot()
 {
@@ -522,6 +560,8 @@ Test::Main()
     TEST_FLUSH();
     testAndWith();
     TEST_FLUSH();
+    testSparseIntersection();
+    TEST_FLUSH();
     TEST_DONE();
 }
 
@@ -684,4 +684,35 @@ TEST("verify search iterator conformance") {
     }
 }
 
+std::vector<uint32_t> collect_strict_hits(SearchIterator &search, uint32_t docid_limit) {
+    std::vector<uint32_t> hits;
+    search.initRange(1, docid_limit);
+    for (search.seek(1); !search.isAtEnd(); search.seek(search.getDocId() + 1)) {
+        search.unpack(search.getDocId());
+        hits.push_back(search.getDocId());
+    }
+    return hits;
+}
+
+TEST("require that block-max pruning over attribute posting lists gives the same hits as plain wand") {
+    // long posting lists of light documents with a few heavy documents
+    const uint32_t docid_limit = 10000;
+    DocumentWeightAttributeHelper helper;
+    helper.add_docs(docid_limit);
+    for (uint32_t docid = 1; docid < docid_limit; ++docid) {
+        bool heavy = ((docid == 100) || (docid == 5001) || (docid == 7777));
+        helper.set_doc(docid, docid % 2, heavy ? 1000 : ((docid % 7) + 1));
+    }
+    std::vector<int32_t> weights({1, 2});
+    std::vector<IDocumentWeightAttribute::LookupResult> dict_entries({helper.dwa().lookup("0"), helper.dwa().lookup("1")});
+    DummyHeap heap;
+    MatchParams match_params(heap, 1500, 1.0, 1);
+    TermFieldMatchData tfmd;
+    auto plain = create_wand(false, tfmd, match_params, weights, dict_entries, helper.dwa(), true);
+    auto block_max = create_wand(true, tfmd, match_params, weights, dict_entries, helper.dwa(), true);
+    std::vector<uint32_t> expect({5001, 7777});
+    EXPECT_TRUE(expect == collect_strict_hits(*plain, docid_limit));
+    EXPECT_TRUE(expect == collect_strict_hits(*block_max, docid_limit));
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -0,0 +1,133 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+// Benchmark for predicate_search, with many query terms against documents
+// with disjunctions of conjunctions.
+
+#include <vespa/log/log.h>
+LOG_SETUP("predicate_search_benchmark");
+
+#include <vespa/searchlib/fef/termfieldmatchdataarray.h>
+#include <vespa/searchlib/predicate/predicate_index.h>
+#include <vespa/searchlib/predicate/predicate_interval_posting_list.h>
+#include <vespa/searchlib/predicate/predicate_tree_annotator.h>
+#include <vespa/searchlib/queryeval/predicate_search.h>
+#include <vespa/vespalib/testkit/testapp.h>
+#include <vespa/vespalib/util/benchmark_timer.h>
+#include <algorithm>
+#include <random>
+
+using search::fef::TermFieldMatchDataArray;
+using namespace search;
+using namespace search::queryeval;
+using namespace search::predicate;
+using std::vector;
+
+namespace {
+
+constexpr uint32_t num_docs = 200000;
+constexpr uint32_t num_features = 2000;
+constexpr uint32_t num_query_terms = 300;
+
+struct DummyDocIdLimitProvider : public DocIdLimitProvider {
+    uint32_t getDocIdLimit() const override { return num_docs; }
+    uint32_t getCommittedDocIdLimit() const override { return num_docs; }
+};
+
+/**
+ * Each document holds a predicate of one to three conjunctions that
+ * share the same interval positions, e.g. (a and b) or (c and d) gives
+ * a=[1,1], b=[2,2], c=[1,1], d=[2,2]. Only the features of the query
+ * terms are indexed, and the posting lists are read from the interval
+ * store like PredicateBlueprint does.
+ */
+struct Corpus {
+    vespalib::GenerationHandler generation_handler;
+    vespalib::GenerationHolder generation_holder;
+    DummyDocIdLimitProvider limit_provider;
+    PredicateIndex index;
+    vector<uint8_t> min_feature;
+    vector<uint16_t> interval_range;
+    vector<uint8_t> kv;
+
+    Corpus()
+        : generation_handler(),
+          generation_holder(),
+          limit_provider(),
+          index(generation_handler, generation_holder, limit_provider, SimpleIndexConfig(), 8),
+          min_feature(num_docs, 0),
+          interval_range(num_docs, 1),
+          kv(num_docs, 0)
+    {
+        std::mt19937 rnd(42);
+        for (uint32_t doc_id = 1; doc_id < num_docs; ++doc_id) {
+            uint32_t terms_per_clause = 1 + rnd() % 4;
+            uint32_t clauses = 1 + rnd() % 3;
+            PredicateTreeAnnotations annotations(terms_per_clause, terms_per_clause);
+            for (uint32_t clause = 0; clause < clauses; ++clause) {
+                for (uint32_t pos = 1; pos <= terms_per_clause; ++pos) {
+                    // Skew the features so that the query terms are common.
+                    uint32_t feature = std::min(rnd() % num_features, rnd() % num_features);
+                    if (feature < num_query_terms) {
+                        auto &intervals = annotations.interval_map[feature];
+                        Interval interval{(pos << 16) | pos};
+                        if (std::find(intervals.begin(), intervals.end(), interval) == intervals.end()) {
+                            intervals.push_back(interval);
+                        }
+                    }
+                }
+            }
+            for (auto &entry : annotations.interval_map) {
+                std::sort(entry.second.begin(), entry.second.end(),
+                          [](const Interval &a, const Interval &b) { return a.interval < b.interval; });
+            }
+            min_feature[doc_id] = terms_per_clause;
+            interval_range[doc_id] = terms_per_clause;
+            kv[doc_id] = annotations.interval_map.size();
+            index.indexDocument(doc_id, annotations);
+        }
+        index.commit();
+    }
+
+    vector<PredicatePostingList::UP> make_posting_lists() const {
+        using PostingList = PredicateIntervalPostingList<PredicateIndex::BTreeIterator>;
+        const auto &interval_index = index.getIntervalIndex();
+        vector<PredicatePostingList::UP> result;
+        for (uint64_t feature = 0; feature < num_query_terms; ++feature) {
+            auto it = interval_index.lookup(feature);
+            if (it.valid()) {
+                result.emplace_back(std::make_unique<PostingList>(
+                        index.getIntervalStore(), interval_index.getBTreePostingList(it.getData())));
+            }
+        }
+        return result;
+    }
+};
+
+uint32_t count_hits(SearchIterator &search) {
+    uint32_t hits = 0;
+    search.initRange(1, num_docs);
+    for (search.seek(1); !search.isAtEnd(); search.seek(search.getDocId() + 1)) {
+        ++hits;
+    }
+    return hits;
+}
+
+}  // namespace
+
+TEST("benchmark predicate search with many query terms") {
+    Corpus corpus;
+    TermFieldMatchDataArray tfmda;
+    uint16_t max_interval_range = *std::max_element(corpus.interval_range.begin(), corpus.interval_range.end());
+    uint32_t hits = 0;
+    vespalib::BenchmarkTimer timer(5.0);
+    while (timer.has_budget()) {
+        PredicateSearch search(&corpus.min_feature[0], &corpus.interval_range[0], max_interval_range,
+                               corpus.kv, corpus.make_posting_lists(), tfmda);
+        timer.before();
+        hits = count_hits(search);
+        timer.after();
+    }
+    EXPECT_LESS(0u, hits);
+    fprintf(stderr, "%u hits of %u documents in %.3f ms\n", hits, num_docs, timer.min_time() * 1000.0);
+}
+
+TEST_MAIN() { TEST_RUN_ALL(); }
@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 #include <vespa/searchlib/transactionlog/translogclient.h>
 #include <vespa/searchlib/transactionlog/translogserver.h>
+#include <vespa/searchlib/transactionlog/domain.h>
 #include <vespa/vespalib/testkit/testapp.h>
 #include <vespa/vespalib/objects/identifiable.h>
 #include <vespa/searchlib/index/dummyfileheadercontext.h>
@@ -53,6 +54,7 @@ private:
     void testSync();
     void testTruncateOnShortRead();
     void testTruncateOnVersionMismatch();
+    void testGroupCommit();
 };
 
 TEST_APPHOOK(Test);
@@ -898,6 +900,71 @@ Test::testTruncateOnShortRead()
     }
 }
 
+namespace {
+
+Packet
+makePacket(SerialNum serial)
+{
+    Packet packet;
+    ASSERT_TRUE(packet.add(Packet::Entry(serial, 1, vespalib::ConstBufferRef((const char *)&serial, sizeof(serial)))));
+    packet.close();
+    return packet;
+}
+
+}
+
+void
+Test::testGroupCommit()
+{
+    DummyFileHeaderContext fileHeaderContext;
+    vespalib::ThreadStackExecutor executor(1, 128*1024);
+    Domain domain("groupcommit", "test14", executor, 0x1000000, true, DomainPart::xxh64, fileHeaderContext);
+
+    // Keep the committer busy in a callback while the next group is queued.
+    vespalib::Gate committerBlocked;
+    vespalib::Gate releaseCommitter;
+    domain.commit(makePacket(1), [&](const vespalib::string &) {
+        committerBlocked.countDown();
+        releaseCommitter.await();
+    });
+    committerBlocked.await();
+    std::vector<SerialNum> serials({2, 3, 3, 4, 5});
+    std::vector<size_t> order;
+    std::vector<SerialNum> endAtCallback;
+    std::vector<vespalib::string> errors;
+    vespalib::CountDownLatch done(serials.size());
+    for (size_t i(0); i < serials.size(); i++) {
+        domain.commit(makePacket(serials[i]), [&, i](const vespalib::string & error) {
+            order.push_back(i);
+            endAtCallback.push_back(domain.end());
+            errors.push_back(error);
+            done.countDown();
+        });
+    }
+    releaseCommitter.countDown();
+    done.await();
+    ASSERT_EQUAL(serials.size(), order.size());
+    for (size_t i(0); i < serials.size(); i++) {
+        EXPECT_EQUAL(i, order[i]);
+        // All packets in the group are written before the first callback is called.
+        EXPECT_EQUAL(5u, endAtCallback[i]);
+    }
+    EXPECT_EQUAL("", errors[0]);
+    EXPECT_EQUAL("", errors[1]);
+    EXPECT_TRUE(errors[2].find("must be bigger") != vespalib::string::npos);
+    EXPECT_EQUAL("", errors[3]);
+    EXPECT_EQUAL("", errors[4]);
+
+    // A failing callback does not stop later commits.
+    domain.commit(makePacket(6), [](const vespalib::string &) { throw std::runtime_error("callback failed"); });
+    domain.commit(makePacket(7));
+    EXPECT_EQUAL(7u, domain.end());
+    EXPECT_EXCEPTION(domain.commit(makePacket(7)), std::runtime_error, "must be bigger");
+
+    EXPECT_TRUE(domain.erase(3));
+    EXPECT_EQUAL(3u, domain.begin());
+    EXPECT_EQUAL(7u, domain.end());
+}
 
 int Test::Main()
 {
@@ -920,6 +987,8 @@ int Test::Main()
     testTruncateOnVersionMismatch();
 
     testCrcVersions();
+
+    TEST_DO(testGroupCommit());
     
     TEST_DONE();
 }
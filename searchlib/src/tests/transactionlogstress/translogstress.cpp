@@ -7,6 +7,7 @@
 #include <vespa/searchlib/util/runnable.h>
 #include <vespa/searchlib/index/dummyfileheadercontext.h>
 #include <vespa/fastos/app.h>
+#include <atomic>
 #include <iostream>
 #include <stdexcept>
 #include <sstream>
@@ -659,6 +660,108 @@ ControllerThread::doRun()
 }
 
 
+//-----------------------------------------------------------------------------
+// CommitBenchmark
+//-----------------------------------------------------------------------------
+/**
+ * Measures the commit throughput of a domain using fsync for a given number of
+ * feeder threads. Each feeder waits for its commit before making the next one,
+ * so throughput only grows with the number of feeders when concurrent commits
+ * share a sync.
+ */
+class CommitBenchmark
+{
+private:
+    class CommitFeederThread : public Runnable
+    {
+    private:
+        CommitBenchmark & _owner;
+        uint64_t _numCommits;
+    public:
+        CommitFeederThread(CommitBenchmark & owner) : _owner(owner), _numCommits(0) {}
+        void doRun() override;
+        uint64_t getNumCommits() const { return _numCommits; }
+    };
+
+    EntryGenerator _generator;
+    uint64_t _domainPartSize;
+    vespalib::Lock _lock;
+    std::unique_ptr<Domain> _domain;
+    SerialNum _current;
+    std::atomic<uint64_t> _numFailed;
+
+    void commitOne();
+
+public:
+    CommitBenchmark(const EntryGenerator & generator, uint64_t domainPartSize);
+    ~CommitBenchmark();
+    /**
+     * Run the given number of feeders for the given time (ms) and return commits per second.
+     */
+    double run(uint32_t numFeeders, uint64_t runTime);
+    uint64_t getNumFailed() const { return _numFailed; }
+};
+
+CommitBenchmark::CommitBenchmark(const EntryGenerator & generator, uint64_t domainPartSize)
+    : _generator(generator), _domainPartSize(domainPartSize), _lock(), _domain(), _current(1), _numFailed(0)
+{}
+CommitBenchmark::~CommitBenchmark() {}
+
+void
+CommitBenchmark::commitOne()
+{
+    vespalib::Gate gate;
+    {
+        // Serial numbers must be committed in order, so they are assigned when queuing the commit.
+        vespalib::LockGuard guard(_lock);
+        Packet packet;
+        packet.add(_generator.getRandomEntry(_current++));
+        _domain->commit(packet, [this, &gate](const vespalib::string & error) {
+            if ( ! error.empty()) {
+                LOG(error, "CommitBenchmark: %s", error.c_str());
+                _numFailed++;
+            }
+            gate.countDown();
+        });
+    }
+    gate.await();
+}
+
+void
+CommitBenchmark::CommitFeederThread::doRun()
+{
+    while (!_done) {
+        _owner.commitOne();
+        ++_numCommits;
+    }
+}
+
+double
+CommitBenchmark::run(uint32_t numFeeders, uint64_t runTime)
+{
+    DummyFileHeaderContext fileHeaderContext;
+    vespalib::ThreadStackExecutor executor(1, 128 * 1024);
+    _domain.reset(new Domain(make_string("commitbench%u", numFeeders), "server", executor,
+                             _domainPartSize, true, DomainPart::xxh64, fileHeaderContext));
+    FastOS_ThreadPool threadPool(256000);
+    std::vector<std::unique_ptr<CommitFeederThread>> feeders;
+    for (uint32_t i = 0; i < numFeeders; ++i) {
+        feeders.emplace_back(new CommitFeederThread(*this));
+        threadPool.NewThread(feeders.back().get());
+    }
+    FastOS_Thread::Sleep(runTime);
+    uint64_t numCommits = 0;
+    for (auto & feeder : feeders) {
+        feeder->stop();
+        feeder->join();
+        numCommits += feeder->getNumCommits();
+    }
+    threadPool.Close();
+    _domain.reset();
+    return (1000.0 * numCommits) / runTime;
+}
+
+
 //-----------------------------------------------------------------------------
 // TransLogStress
 //-----------------------------------------------------------------------------
@@ -681,16 +784,19 @@ private:
     uint32_t minStrLen;
     uint32_t maxStrLen;
     long baseSeed;
+    uint32_t maxCommitFeeders;
 
     Config() :
         domainPartSize(0), packetSize(0), stressTime(0), feedRate(0), numSubscribers(0),
-        numVisitors(0), visitorInterval(0), pruneInterval(0), minStrLen(0), maxStrLen(0), baseSeed(0) {}
+        numVisitors(0), visitorInterval(0), pruneInterval(0), minStrLen(0), maxStrLen(0), baseSeed(0),
+        maxCommitFeeders(0) {}
     };
 
     Config _cfg;
 
     void printConfig();
     void usage();
+    int runCommitBenchmark(const EntryGenerator & generator);
 
 public:
     int Main() override;
@@ -712,6 +818,7 @@ TransLogStress::printConfig()
     std::cout << "baseSeed:               " << _cfg.baseSeed << std::endl;
     std::cout << "domainPartSize:         " << _cfg.domainPartSize << " bytes" << std::endl;
     std::cout << "packetSize:             " << _cfg.packetSize << " bytes" << std::endl;
+    std::cout << "maxCommitFeeders:       " << _cfg.maxCommitFeeders << std::endl;
 }
 
 void
@@ -720,7 +827,22 @@ TransLogStress::usage()
     std::cout << "usage: translogstress [-t stressTime(s)] [-f feedRate] [-s numSubscribers]" << std::endl;
     std::cout << "                      [-v numVisitors] [-c visitorInterval(ms)] [-e pruneInterval(s)]" << std::endl;
     std::cout << "                      [-g numPreGeneratedBuffers] [-i minStrLen] [-a maxStrLen] [-b baseSeed]" << std::endl;
-    std::cout << "                      [-d domainPartSize] [-p packetSize]" << std::endl;
+    std::cout << "                      [-d domainPartSize] [-p packetSize] [-n maxCommitFeeders]" << std::endl;
+    std::cout << "  -n runs a commit benchmark with fsync for 1, 2, 4 ... maxCommitFeeders feeders," << std::endl;
+    std::cout << "     each running for stressTime, instead of the stress test." << std::endl;
+}
+
+int
+TransLogStress::runCommitBenchmark(const EntryGenerator & generator)
+{
+    CommitBenchmark benchmark(generator, _cfg.domainPartSize);
+    for (uint32_t numFeeders = 1; numFeeders <= _cfg.maxCommitFeeders; numFeeders *= 2) {
+        double opsPerSec = benchmark.run(numFeeders, _cfg.stressTime);
+        std::cout << "<commitbenchmark feeders='" << numFeeders << "'>" << std::endl;
+        std::cout << "  <opspersec>" << opsPerSec << "</opspersec>" << std::endl;
+        std::cout << "</commitbenchmark>" << std::endl;
+    }
+    return (benchmark.getNumFailed() == 0) ? 0 : 1;
 }
 
 int
@@ -749,7 +871,7 @@ TransLogStress::Main()
     char opt;
     const char * arg;
     bool optError = false;
-    while ((opt = GetOpt("d:p:t:f:s:v:c:e:g:i:a:b:h", arg, idx)) != -1) {
+    while ((opt = GetOpt("d:p:t:f:s:v:c:e:g:i:a:b:n:h", arg, idx)) != -1) {
         switch (opt) {
         case 'd':
             _cfg.domainPartSize = atol(arg);
@@ -787,6 +909,9 @@ TransLogStress::Main()
         case 'b':
             _cfg.baseSeed = atol(arg);
             break;
+        case 'n':
+            _cfg.maxCommitFeeders = atoi(arg);
+            break;
         case 'h':
             usage();
             return -1;
@@ -797,21 +922,12 @@ TransLogStress::Main()
     }
 
     printConfig();
-    FastOS_Thread::Sleep(sleepTime);
 
     if (_argc != idx || optError) {
         usage();
         return -1;
     }
 
-    // start transaction log server
-    DummyFileHeaderContext fileHeaderContext;
-    TransLogServer tls("server", 17897, ".", fileHeaderContext, _cfg.domainPartSize);
-    TransLogClient client(tlsSpec);
-    client.create(domain);
-
-    FastOS_ThreadPool threadPool(256000);
-
     BufferGenerator bufferGenerator(_cfg.minStrLen, _cfg.maxStrLen);
     bufferGenerator.setSeed(_cfg.baseSeed);
     std::vector<ByteBuffer> buffers;
@@ -823,6 +939,20 @@ TransLogStress::Main()
         generator.setBuffers(buffers);
     }
 
+    if (_cfg.maxCommitFeeders > 0) {
+        return runCommitBenchmark(generator);
+    }
+
+    FastOS_Thread::Sleep(sleepTime);
+
+    // start transaction log server
+    DummyFileHeaderContext fileHeaderContext;
+    TransLogServer tls("server", 17897, ".", fileHeaderContext, _cfg.domainPartSize);
+    TransLogClient client(tlsSpec);
+    client.create(domain);
+
+    FastOS_ThreadPool threadPool(256000);
+
 
     // start feeder and controller
     FeederThread feeder(tlsSpec, domain, generator, _cfg.feedRate, _cfg.packetSize);
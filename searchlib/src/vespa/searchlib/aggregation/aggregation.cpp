@@ -6,6 +6,8 @@
 #include <vespa/document/fieldvalue/document.h>
 #include <vespa/vespalib/objects/visit.hpp>
 #include <vespa/vespalib/xxhash/xxhash.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <algorithm>
 
 namespace search {
 
@@ -38,6 +40,7 @@ IMPLEMENT_AGGREGATIONRESULT(AverageAggregationResult, AggregationResult);
 IMPLEMENT_AGGREGATIONRESULT(XorAggregationResult,     AggregationResult);
 IMPLEMENT_AGGREGATIONRESULT(ExpressionCountAggregationResult, AggregationResult);
 IMPLEMENT_AGGREGATIONRESULT(StandardDeviationAggregationResult, AggregationResult);
+IMPLEMENT_AGGREGATIONRESULT(TopKAggregationResult, AggregationResult);
 
 AggregationResult::AggregationResult() :
     _expressionTree(new ExpressionTree()),
@@ -578,6 +581,201 @@ void StandardDeviationAggregationResult::visitMembers(vespalib::ObjectVisitor &v
     visit(visitor, "sumOfSquared", _sumOfSquared);
 }
 
+TopKAggregationResult::Entry::Entry()
+    : _value(), _hash(0), _count(0), _error(0)
+{ }
+
+TopKAggregationResult::Entry::Entry(const ResultNode &value, uint64_t count, uint64_t error)
+    : _value(value.clone()), _hash(value.hash()), _count(count), _error(error)
+{ }
+
+TopKAggregationResult::Entry::~Entry() { }
+
+TopKAggregationResult::TopKAggregationResult()
+    : TopKAggregationResult(DEFAULT_MAX_ENTRIES)
+{ }
+
+TopKAggregationResult::TopKAggregationResult(uint32_t maxEntries)
+    : AggregationResult(), _maxEntries(maxEntries), _entries(), _rank()
+{ }
+
+TopKAggregationResult::~TopKAggregationResult() { }
+
+TopKAggregationResult::Entry *
+TopKAggregationResult::find(const ResultNode &value, uint64_t hash)
+{
+    for (Entry &entry : _entries) {
+        if ((entry._hash == hash) && (entry._value->cmp(value) == 0)) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t
+TopKAggregationResult::getMinCount() const
+{
+    if ((_entries.size() < _maxEntries) || _entries.empty()) {
+        return 0;
+    }
+    uint64_t minCount = _entries[0]._count;
+    for (const Entry &entry : _entries) {
+        minCount = std::min(minCount, entry._count);
+    }
+    return minCount;
+}
+
+void
+TopKAggregationResult::sortAndTruncate()
+{
+    std::stable_sort(_entries.begin(), _entries.end(),
+                     [](const Entry &a, const Entry &b) { return a._count > b._count; });
+    if (_entries.size() > _maxEntries) {
+        _entries.resize(_maxEntries);
+    }
+}
+
+void
+TopKAggregationResult::updateRank()
+{
+    uint64_t maxCount = 0;
+    for (const Entry &entry : _entries) {
+        maxCount = std::max(maxCount, entry._count);
+    }
+    _rank.set(maxCount);
+}
+
+void
+TopKAggregationResult::add(const ResultNode &value)
+{
+    uint64_t hash = value.hash();
+    Entry *entry = find(value, hash);
+    if (entry == nullptr) {
+        if (_entries.size() < _maxEntries) {
+            _entries.emplace_back(value, 0, 0);
+            entry = &_entries.back();
+        } else if (!_entries.empty()) {
+            // Replace the entry with the lowest count, and inherit its count as the possible error.
+            entry = &_entries[0];
+            for (Entry &candidate : _entries) {
+                if (candidate._count < entry->_count) {
+                    entry = &candidate;
+                }
+            }
+            entry->_value.reset(value.clone());
+            entry->_hash = hash;
+            entry->_error = entry->_count;
+        } else {
+            return;
+        }
+    }
+    entry->_count++;
+    if (entry->_count > static_cast<uint64_t>(_rank.get())) {
+        _rank.set(entry->_count);
+    }
+}
+
+void
+TopKAggregationResult::onAggregate(const ResultNode &result)
+{
+    if (result.isMultiValue()) {
+        const ResultNodeVector &v = static_cast<const ResultNodeVector &>(result);
+        for (size_t i(0), m(v.size()); i < m; i++) {
+            add(v.get(i));
+        }
+    } else {
+        add(result);
+    }
+}
+
+void
+TopKAggregationResult::onMerge(const AggregationResult &r)
+{
+    const TopKAggregationResult &result = Identifiable::cast<const TopKAggregationResult &>(r);
+    _maxEntries = std::max(_maxEntries, result._maxEntries);
+    // A value not tracked by one summary may have occurred up to its lowest count times there.
+    uint64_t myMin = getMinCount();
+    uint64_t otherMin = result.getMinCount();
+    size_t myEntries = _entries.size();
+    std::vector<bool> seen(myEntries, false);
+    _entries.reserve(myEntries + result._entries.size());
+    for (const Entry &other : result._entries) {
+        Entry *entry = find(*other._value, other._hash);
+        if (entry != nullptr) {
+            entry->_count += other._count;
+            entry->_error += other._error;
+            seen[entry - &_entries[0]] = true;
+        } else {
+            _entries.emplace_back(*other._value, other._count + myMin, other._error + myMin);
+        }
+    }
+    for (size_t i(0); i < myEntries; i++) {
+        if (!seen[i]) {
+            _entries[i]._count += otherMin;
+            _entries[i]._error += otherMin;
+        }
+    }
+    sortAndTruncate();
+    updateRank();
+}
+
+void
+TopKAggregationResult::postMerge()
+{
+    sortAndTruncate();
+}
+
+void
+TopKAggregationResult::onReset()
+{
+    _entries.clear();
+    _rank.set(0);
+}
+
+Serializer &
+TopKAggregationResult::onSerialize(Serializer & os) const
+{
+    AggregationResult::onSerialize(os);
+    os << _maxEntries << static_cast<uint32_t>(_entries.size());
+    for (const Entry &entry : _entries) {
+        os << entry._value << entry._count << entry._error;
+    }
+    return os;
+}
+
+Deserializer &
+TopKAggregationResult::onDeserialize(Deserializer & is)
+{
+    AggregationResult::onDeserialize(is);
+    uint32_t numEntries(0);
+    is >> _maxEntries >> numEntries;
+    _entries.clear();
+    _entries.resize(numEntries);
+    for (Entry &entry : _entries) {
+        is >> entry._value >> entry._count >> entry._error;
+        entry._hash = entry._value.get() ? entry._value->hash() : 0;
+    }
+    updateRank();
+    return is;
+}
+
+void
+TopKAggregationResult::visitMembers(vespalib::ObjectVisitor &visitor) const
+{
+    AggregationResult::visitMembers(visitor);
+    visit(visitor, "maxEntries", _maxEntries);
+    visitor.openStruct("entries", "std::vector");
+    for (size_t i(0); i < _entries.size(); i++) {
+        const Entry &entry = _entries[i];
+        visitor.openStruct(vespalib::make_string("[%zu]", i), "Entry");
+        visit(visitor, "value", entry._value);
+        visit(visitor, "count", entry._count);
+        visit(visitor, "error", entry._error);
+        visitor.closeStruct();
+    }
+    visitor.closeStruct();
+}
+
 }  // namespace aggregation
 }  // namespace search
 
@@ -12,6 +12,7 @@
 #include <vespa/searchlib/aggregation/xoraggregationresult.h>
 #include <vespa/searchlib/aggregation/hitsaggregationresult.h>
 #include <vespa/searchlib/aggregation/standarddeviationaggregationresult.h>
+#include <vespa/searchlib/aggregation/topkaggregationresult.h>
 #include <vespa/searchlib/aggregation/grouping.h>
 
 namespace search {
@@ -18,6 +18,10 @@ public:
     const NumericResultNode & getAverage() const;
     const NumericResultNode & getSum() const { return *_sum; }
     uint64_t getCount()                const { return _count; }
+    AverageAggregationResult &setCount(uint64_t count) {
+        _count = count;
+        return *this;
+    }
 private:
     const ResultNode & onGetRank() const override { return getAverage(); }
     void onPrepare(const ResultNode & result, bool useForInit) override;
@@ -0,0 +1,268 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "columnargrouping.h"
+#include "grouping.h"
+#include "countaggregationresult.h"
+#include "sumaggregationresult.h"
+#include "averageaggregationresult.h"
+#include <vespa/searchlib/expression/attributenode.h>
+#include <vespa/searchlib/expression/integerresultnode.h>
+#include <vespa/searchlib/expression/floatresultnode.h>
+#include <cmath>
+
+namespace search {
+namespace aggregation {
+
+using attribute::IAttributeVector;
+using expression::AttributeNode;
+using expression::ExpressionNode;
+using expression::ResultNode;
+using expression::ResultNodeVector;
+using expression::Int64ResultNode;
+using expression::FloatResultNode;
+
+namespace {
+
+/**
+ * Keys are aggregated into dense arrays as long as the key range is
+ * below this limit, or below the number of hits times this factor.
+ **/
+constexpr uint64_t MIN_DENSE_SLOTS = 4096;
+constexpr uint64_t DENSE_SLOTS_PER_HIT = 2;
+
+const IAttributeVector *
+getSingleValueAttribute(const ExpressionNode *node)
+{
+    if ((node == nullptr) || (node->getClass().id() != AttributeNode::classId)) {
+        return nullptr;
+    }
+    const AttributeNode &attrNode = static_cast<const AttributeNode &>(*node);
+    const IAttributeVector *attr = attrNode.getAttribute();
+    if ((attr == nullptr) || attrNode.hasMultiValue() || attr->hasMultiValue()) {
+        return nullptr;
+    }
+    return attr;
+}
+
+}
+
+ColumnarGrouping::Column::Column(Type type, const IAttributeVector *attr)
+    : _type(type),
+      _attr(attr),
+      _isFloat((attr != nullptr) && attr->isFloatingPointType()),
+      _intSums(),
+      _floatSums()
+{
+}
+
+ColumnarGrouping::Column::~Column() { }
+
+void
+ColumnarGrouping::Column::collect(const std::vector<DocId> &docIds, const std::vector<uint32_t> &slots, uint32_t numSlots)
+{
+    if (_type == COUNT) {
+        return;
+    }
+    size_t numHits(docIds.size());
+    if (_isFloat) {
+        std::vector<double> values(numHits);
+        for (size_t i(0); i < numHits; i++) {
+            values[i] = _attr->getFloat(docIds[i]);
+        }
+        _floatSums.assign(numSlots, 0.0);
+        if (slots.empty()) {
+            for (size_t i(0); i < numHits; i++) {
+                _floatSums[0] += values[i];
+            }
+        } else {
+            for (size_t i(0); i < numHits; i++) {
+                _floatSums[slots[i]] += values[i];
+            }
+        }
+    } else {
+        std::vector<int64_t> values(numHits);
+        for (size_t i(0); i < numHits; i++) {
+            values[i] = _attr->getInt(docIds[i]);
+        }
+        _intSums.assign(numSlots, 0);
+        if (slots.empty()) {
+            for (size_t i(0); i < numHits; i++) {
+                _intSums[0] += values[i];
+            }
+        } else {
+            for (size_t i(0); i < numHits; i++) {
+                _intSums[slots[i]] += values[i];
+            }
+        }
+    }
+}
+
+void
+ColumnarGrouping::Column::apply(uint32_t slot, uint64_t count, AggregationResult &result) const
+{
+    if (_type == COUNT) {
+        result.merge(CountAggregationResult(count));
+        return;
+    }
+    ResultNode::CP sum(_isFloat
+                       ? static_cast<ResultNode *>(new FloatResultNode(_floatSums[slot]))
+                       : static_cast<ResultNode *>(new Int64ResultNode(_intSums[slot])));
+    if (_type == SUM) {
+        SumAggregationResult partial;
+        partial.setResult(sum);
+        result.merge(partial);
+    } else {
+        AverageAggregationResult partial;
+        partial.setResult(sum);
+        partial.setCount(count);
+        result.merge(partial);
+    }
+}
+
+ColumnarGrouping::ColumnarGrouping(Grouping &grouping)
+    : _grouping(grouping),
+      _level(nullptr),
+      _keyAttr(nullptr),
+      _enumKeys(false),
+      _rootColumns(),
+      _groupColumns(),
+      _docIds(),
+      _ranks()
+{
+    if ((grouping.getFirstLevel() != 0) || (grouping.getLevels().size() != 1)) {
+        return;
+    }
+    const GroupingLevel &level = grouping.getLevels()[0];
+    if (level.isFrozen() ||
+        !setupColumns(grouping.getRoot(), _rootColumns) ||
+        !setupColumns(level.getGroupPrototype(), _groupColumns))
+    {
+        return;
+    }
+    const IAttributeVector *keyAttr = getSingleValueAttribute(level.getExpression().getRoot());
+    if ((keyAttr == nullptr) || !(keyAttr->isIntegerType() || (keyAttr->isStringType() && keyAttr->hasEnum()))) {
+        return;
+    }
+    _level = &level;
+    _keyAttr = keyAttr;
+    _enumKeys = !keyAttr->isIntegerType();
+}
+
+ColumnarGrouping::~ColumnarGrouping() { }
+
+bool
+ColumnarGrouping::setupColumns(const Group &prototype, Columns &columns)
+{
+    for (size_t i(0), m(prototype.getAggrSize()); i < m; i++) {
+        const AggregationResult &aggr = prototype.getAggregationResult(i);
+        const ExpressionNode *expr = aggr.getExpression();
+        if (aggr.getClass().id() == CountAggregationResult::classId) {
+            if ((expr != nullptr) && expr->getResult().inherits(ResultNodeVector::classId)) {
+                return false;
+            }
+            columns.emplace_back(Column::COUNT, nullptr);
+        } else if ((aggr.getClass().id() == SumAggregationResult::classId) ||
+                   (aggr.getClass().id() == AverageAggregationResult::classId))
+        {
+            const IAttributeVector *attr = getSingleValueAttribute(expr);
+            if ((attr == nullptr) || !(attr->isIntegerType() || attr->isFloatingPointType())) {
+                return false;
+            }
+            columns.emplace_back((aggr.getClass().id() == SumAggregationResult::classId)
+                                 ? Column::SUM : Column::AVERAGE, attr);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+ColumnarGrouping::readKeys(std::vector<uint32_t> &slots, uint32_t &numSlots) const
+{
+    size_t numHits(_docIds.size());
+    std::vector<int64_t> keys(numHits);
+    if (_enumKeys) {
+        for (size_t i(0); i < numHits; i++) {
+            keys[i] = _keyAttr->getEnum(_docIds[i]);
+        }
+    } else {
+        for (size_t i(0); i < numHits; i++) {
+            keys[i] = _keyAttr->getInt(_docIds[i]);
+        }
+    }
+    int64_t minKey(keys[0]);
+    int64_t maxKey(keys[0]);
+    for (size_t i(1); i < numHits; i++) {
+        minKey = std::min(minKey, keys[i]);
+        maxKey = std::max(maxKey, keys[i]);
+    }
+    uint64_t range = static_cast<uint64_t>(maxKey) - static_cast<uint64_t>(minKey);
+    if (range >= std::max(MIN_DENSE_SLOTS, DENSE_SLOTS_PER_HIT * numHits)) {
+        return false;
+    }
+    numSlots = range + 1;
+    slots.resize(numHits);
+    for (size_t i(0); i < numHits; i++) {
+        slots[i] = static_cast<uint64_t>(keys[i]) - static_cast<uint64_t>(minKey);
+    }
+    return true;
+}
+
+void
+ColumnarGrouping::apply(const Columns &columns, uint32_t slot, uint64_t count, Group &group) const
+{
+    for (size_t i(0), m(columns.size()); i < m; i++) {
+        columns[i].apply(slot, count, group.getAggregationResult(i));
+    }
+}
+
+void
+ColumnarGrouping::aggregate()
+{
+    size_t numHits(_docIds.size());
+    std::vector<uint32_t> slots;
+    uint32_t numSlots(0);
+    if ((numHits == 0) || !readKeys(slots, numSlots)) {
+        for (size_t i(0); i < numHits; i++) {
+            _grouping.aggregate(_docIds[i], _ranks[i]);
+        }
+        return;
+    }
+
+    // Count hits and track the max rank per key, remembering the first hit seen for each key.
+    std::vector<uint32_t> counts(numSlots, 0);
+    std::vector<HitRank> ranks(numSlots, 0.0);
+    std::vector<uint32_t> firstHits;
+    for (size_t i(0); i < numHits; i++) {
+        uint32_t slot = slots[i];
+        if (counts[slot]++ == 0) {
+            firstHits.push_back(i);
+            ranks[slot] = std::isnan(_ranks[i]) ? -HUGE_VAL : _ranks[i];
+        } else {
+            ranks[slot] = std::max(ranks[slot], _ranks[i]);
+        }
+    }
+    for (Column &column : _rootColumns) {
+        column.collect(_docIds, std::vector<uint32_t>(), 1);
+    }
+    for (Column &column : _groupColumns) {
+        column.collect(_docIds, slots, numSlots);
+    }
+
+    Group &root = _grouping.root();
+    apply(_rootColumns, 0, numHits, root);
+    bool collectGroups(_grouping.getLastLevel() > 0);
+    const expression::ExpressionTree &selector = _level->getExpression();
+    for (uint32_t hit : firstHits) {
+        uint32_t slot = slots[hit];
+        selector.execute(_docIds[hit], _ranks[hit]);
+        Group *group = root.groupSingle(selector.getResult(), ranks[slot], *_level);
+        if ((group != nullptr) && collectGroups) {
+            apply(_groupColumns, slot, counts[slot], *group);
+        }
+    }
+}
+
+}
+}
@@ -0,0 +1,84 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#pragma once
+
+#include <vespa/searchlib/common/hitrank.h>
+#include <vespa/searchlib/expression/expressionnode.h>
+#include <vector>
+
+namespace search {
+
+namespace attribute { class IAttributeVector; }
+
+namespace aggregation {
+
+class AggregationResult;
+class Group;
+class Grouping;
+class GroupingLevel;
+
+/**
+ * Columnar fast path for the most common grouping requests: a single
+ * level grouped on a single value integer or string attribute, where
+ * all aggregators are count(), or sum() and avg() of single value
+ * numeric attributes. The hits are gathered into columns of docids and
+ * ranks. The group keys are then read in one pass, and if they fall
+ * within a small range, each aggregator is computed in a tight loop
+ * over its own column into dense arrays indexed by key. Groups are only
+ * created at the end, in the order their keys were first seen, so the
+ * resulting tree is identical to the one created when aggregating one
+ * hit at a time. If the keys are too sparse, the hits are aggregated
+ * one at a time as usual.
+ **/
+class ColumnarGrouping
+{
+public:
+    using DocId = expression::DocId;
+
+    ColumnarGrouping(Grouping &grouping);
+    ColumnarGrouping(const ColumnarGrouping &) = delete;
+    ColumnarGrouping & operator = (const ColumnarGrouping &) = delete;
+    ~ColumnarGrouping();
+
+    /**
+     * Returns true if the grouping request can be handled by this class.
+     **/
+    bool valid() const { return _keyAttr != nullptr; }
+    void addHit(DocId docId, HitRank rank) {
+        _docIds.push_back(docId);
+        _ranks.push_back(rank);
+    }
+    void aggregate();
+private:
+    class Column
+    {
+    public:
+        enum Type { COUNT, SUM, AVERAGE };
+        Column(Type type, const attribute::IAttributeVector *attr);
+        ~Column();
+        void collect(const std::vector<DocId> &docIds, const std::vector<uint32_t> &slots, uint32_t numSlots);
+        void apply(uint32_t slot, uint64_t count, AggregationResult &result) const;
+    private:
+        Type                              _type;
+        const attribute::IAttributeVector *_attr;
+        bool                              _isFloat;
+        std::vector<int64_t>              _intSums;
+        std::vector<double>               _floatSums;
+    };
+    using Columns = std::vector<Column>;
+
+    static bool setupColumns(const Group &prototype, Columns &columns);
+    bool readKeys(std::vector<uint32_t> &slots, uint32_t &numSlots) const;
+    void apply(const Columns &columns, uint32_t slot, uint64_t count, Group &group) const;
+
+    Grouping                          &_grouping;
+    const GroupingLevel               *_level;
+    const attribute::IAttributeVector *_keyAttr;
+    bool                               _enumKeys;
+    Columns                            _rootColumns;
+    Columns                            _groupColumns;
+    std::vector<DocId>                 _docIds;
+    std::vector<HitRank>               _ranks;
+};
+
+}
+}
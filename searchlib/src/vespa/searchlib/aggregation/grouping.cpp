@@ -2,6 +2,7 @@
 
 #include "grouping.h"
 #include "hitsaggregationresult.h"
+#include "columnargrouping.h"
 #include <vespa/searchlib/expression/stringresultnode.h>
 #include <vespa/searchlib/expression/enumresultnode.h>
 #include <vespa/searchlib/expression/resultvector.h>
@@ -117,7 +118,8 @@ Grouping::Grouping()
       _levels(),
       _root(),
       _clock(NULL),
-      _timeOfDoom(0)
+      _timeOfDoom(0),
+      _columnar(true)
 {
 }
 
@@ -217,16 +219,41 @@ void Grouping::aggregateWithClock(const RankedHit * rankedHit, unsigned int len)
     }
 }
 
+bool Grouping::aggregateColumnar(const RankedHit * rankedHit, unsigned int len, const BitVector * bVec)
+{
+    if (!_columnar) {
+        return false;
+    }
+    ColumnarGrouping columnar(*this);
+    if (!columnar.valid()) {
+        return false;
+    }
+    for(unsigned int i(0); (i < len) && ((_clock == NULL) || !hasExpired()); i++) {
+        columnar.addHit(rankedHit[i]._docId, rankedHit[i]._rankValue);
+    }
+    if (bVec != NULL) {
+        unsigned int sz(bVec->size());
+        size_t m((getTopN() > 0) ? getMaxN(sz) : sz);
+        for(DocId d(bVec->getFirstTrueBit()), i(0); (d < sz) && (i < m) && ((_clock == NULL) || !hasExpired()); d = bVec->getNextTrueBit(d+1), i++) {
+            columnar.addHit(d, 0.0);
+        }
+    }
+    columnar.aggregate();
+    return true;
+}
+
 void Grouping::aggregate(const RankedHit * rankedHit, unsigned int len)
 {
     bool isOrdered(! needResort());
     preAggregate(isOrdered);
     HitsAggregationResult::SetOrdered pred;
     select(pred, pred);
-    if (_clock == NULL) {
-        aggregateWithoutClock(rankedHit, getMaxN(len));
-    } else {
-        aggregateWithClock(rankedHit, getMaxN(len));
+    if (!aggregateColumnar(rankedHit, getMaxN(len), NULL)) {
+        if (_clock == NULL) {
+            aggregateWithoutClock(rankedHit, getMaxN(len));
+        } else {
+            aggregateWithClock(rankedHit, getMaxN(len));
+        }
     }
     postProcess();
 }
@@ -234,6 +261,10 @@ void Grouping::aggregate(const RankedHit * rankedHit, unsigned int len)
 void Grouping::aggregate(const RankedHit * rankedHit, unsigned int len, const BitVector * bVec)
 {
     preAggregate(false);
+    if (aggregateColumnar(rankedHit, getMaxN(len), bVec)) {
+        postProcess();
+        return;
+    }
     if (_clock == NULL) {
         aggregateWithoutClock(rankedHit, getMaxN(len));
     } else {
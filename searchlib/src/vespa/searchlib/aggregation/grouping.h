@@ -32,10 +32,12 @@ private:
     Group              _root;       // the grouping tree
     const vespalib::Clock *_clock;      // An optional clock to be used for timeout handling.
     fastos::TimeStamp      _timeOfDoom; // Used if clock is specified. This is time when request expires.
+    bool               _columnar;   // if true, use the columnar fast path for requests supporting it
 
     bool hasExpired() const { return _clock->getTimeNS() >= _timeOfDoom; }
     void aggregateWithoutClock(const RankedHit * rankedHit, unsigned int len);
     void aggregateWithClock(const RankedHit * rankedHit, unsigned int len);
+    bool aggregateColumnar(const RankedHit * rankedHit, unsigned int len, const BitVector * bVec);
     void postProcess();
 public:
     DECLARE_IDENTIFIABLE_NS2(search, aggregation, Grouping);
@@ -60,10 +62,12 @@ public:
     Grouping &setRoot(const Group &root_)       { _root = root_;            return *this; }
     Grouping &setClock(const vespalib::Clock * clock) { _clock = clock; return *this; }
     Grouping &setTimeOfDoom(fastos::TimeStamp timeOfDoom) { _timeOfDoom = timeOfDoom; return *this; }
+    Grouping &setColumnar(bool v)               { _columnar = v;            return *this; }
 
     unsigned int getId()     const { return _id; }
     bool valid()             const { return _valid; }
     bool getAll()            const { return _all; }
+    bool getColumnar()       const { return _columnar; }
     int64_t getTopN()        const { return _topN; }
     size_t getMaxN(size_t n) const { return std::min(n, static_cast<size_t>(getTopN())); }
     uint32_t getFirstLevel() const { return _firstLevel; }
@@ -0,0 +1,74 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#pragma once
+
+#include "aggregationresult.h"
+#include <vespa/searchlib/expression/integerresultnode.h>
+#include <vector>
+
+namespace search::aggregation {
+
+/**
+ * Approximates the most frequent values of an expression using the
+ * space saving algorithm. At most maxEntries values are tracked, each
+ * with an estimated count and an upper bound on how much that count
+ * may be overestimated. When a new value is seen and all entries are
+ * in use, the entry with the lowest count is replaced. Summaries from
+ * different nodes are merged by adding counts, using the lowest count
+ * of the other summary for values it does not track, so the memory and
+ * the serialized size stay bounded no matter how many distinct values
+ * are seen. The rank is the count of the most frequent value.
+ */
+class TopKAggregationResult : public AggregationResult
+{
+public:
+    static constexpr uint32_t DEFAULT_MAX_ENTRIES = 16;
+
+    class Entry {
+    public:
+        Entry();
+        Entry(const ResultNode &value, uint64_t count, uint64_t error);
+        Entry(Entry &&) = default;
+        Entry & operator = (Entry &&) = default;
+        Entry(const Entry &) = default;
+        Entry & operator = (const Entry &) = default;
+        ~Entry();
+        const ResultNode & getValue() const { return *_value; }
+        uint64_t getCount() const { return _count; }
+        uint64_t getError() const { return _error; }
+    private:
+        friend class TopKAggregationResult;
+        ResultNode::CP _value;
+        uint64_t       _hash;
+        uint64_t       _count;
+        uint64_t       _error;
+    };
+    using EntryList = std::vector<Entry>;
+
+    DECLARE_AGGREGATIONRESULT(TopKAggregationResult);
+    TopKAggregationResult();
+    TopKAggregationResult(uint32_t maxEntries);
+    ~TopKAggregationResult();
+
+    void visitMembers(vespalib::ObjectVisitor &visitor) const override;
+    void postMerge() override;
+    TopKAggregationResult & setMaxEntries(uint32_t maxEntries) { _maxEntries = maxEntries; return *this; }
+    uint32_t getMaxEntries() const { return _maxEntries; }
+    /**
+     * The tracked values, ordered by descending count after postMerge.
+     **/
+    const EntryList & getEntries() const { return _entries; }
+private:
+    const ResultNode & onGetRank() const override { return _rank; }
+    void onPrepare(const ResultNode &, bool) override { }
+    void add(const ResultNode &value);
+    Entry * find(const ResultNode &value, uint64_t hash);
+    uint64_t getMinCount() const;
+    void sortAndTruncate();
+    void updateRank();
+
+    uint32_t                    _maxEntries;
+    EntryList                   _entries;
+    expression::Int64ResultNode _rank;
+};
+
+}
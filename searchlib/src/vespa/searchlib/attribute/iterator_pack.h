@@ -43,6 +43,17 @@ public:
         return _children[ref].getData();
     }
 
+    // weight bounds and last docid for the posting list block (b-tree leaf) of the current position
+    int32_t get_block_min_weight(uint16_t ref) const {
+        return _children[ref].getLeafAggregated().getMin();
+    }
+    int32_t get_block_max_weight(uint16_t ref) const {
+        return _children[ref].getLeafAggregated().getMax();
+    }
+    uint32_t get_block_last_docid(uint16_t ref) const {
+        return _children[ref].getLeafLastKey();
+    }
+
     std::unique_ptr<BitVector> get_hits(uint32_t begin_id, uint32_t end_id);
     void or_hits_into(BitVector &result, uint32_t begin_id);
 
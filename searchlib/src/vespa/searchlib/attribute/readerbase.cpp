@@ -5,6 +5,10 @@
 #include <vespa/fastlib/io/bufferedfile.h>
 #include <vespa/vespalib/util/exceptions.h>
 #include <vespa/searchlib/util/filesizecalculator.h>
+#include <vespa/vespalib/util/guard.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".search.attribute.readerbase");
@@ -130,6 +134,21 @@ extractFileSize(const vespalib::GenericHeader &header,
 }
 
 
+vespalib::alloc::Alloc
+ReaderBase::mapData() const
+{
+    size_t dataSize = _datFileSize - _datHeaderLen;
+    if (!hasData() || (dataSize == 0) || ((_datHeaderLen % getpagesize()) != 0)) {
+        return vespalib::alloc::Alloc();
+    }
+    vespalib::FileDescriptor fd(open(_datFile->GetFileName(), O_RDONLY));
+    if (!fd.valid()) {
+        throw vespalib::IllegalStateException(vespalib::make_string("Failed opening '%s' for mapping errno(%d)",
+                                                                    _datFile->GetFileName(), errno));
+    }
+    return vespalib::alloc::Alloc::allocMMapFile(fd.fd(), _datHeaderLen, dataSize);
+}
+
 void
 ReaderBase::rewind()
 {
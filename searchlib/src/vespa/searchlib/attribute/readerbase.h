@@ -3,6 +3,7 @@
 #pragma once
 
 #include <vespa/searchlib/util/fileutil.h>
+#include <vespa/vespalib/util/alloc.h>
 
 namespace search {
 
@@ -46,6 +47,12 @@ public:
     const vespalib::GenericHeader &getDatHeader() const {
         return _datHeader;
     }
+
+    /**
+     * Map the data part of the dat file copy-on-write. Returns an
+     * empty allocation if the data part is empty or not page aligned.
+     */
+    vespalib::alloc::Alloc mapData() const;
 protected:
     std::unique_ptr<FastOS_FileInterface>  _datFile;
 private:
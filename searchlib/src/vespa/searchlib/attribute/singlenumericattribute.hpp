@@ -140,10 +140,19 @@ SingleValueNumericAttribute<B>::onLoad()
     
     const size_t sz(attrReader.getDataCount());
     getGenerationHolder().clearHoldLists();
-    _data.reset();
-    _data.unsafe_reserve(sz);
-    for (uint32_t i = 0; i < sz; ++i) {
-        _data.push_back(attrReader.getNextData());
+    vespalib::alloc::Alloc mapped;
+    if (this->getConfig().mmapLoad()) {
+        mapped = attrReader.mapData();
+    }
+    if (mapped.get() != nullptr) {
+        // Reads are served from the page cache, written pages are copied by the kernel
+        _data.unsafe_adopt(std::move(mapped), sz);
+    } else {
+        _data.reset();
+        _data.unsafe_reserve(sz);
+        for (uint32_t i = 0; i < sz; ++i) {
+            _data.push_back(attrReader.getNextData());
+        }
     }
 
     B::setNumDocs(sz);
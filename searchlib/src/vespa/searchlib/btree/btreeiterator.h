@@ -357,6 +357,26 @@ public:
         return _leaf.valid();
     }
 
+    /**
+     * Get aggregated values for the leaf node containing the current
+     * iterator location.  Iterator must be valid.
+     */
+    const AggrT &
+    getLeafAggregated() const
+    {
+        return _leaf.getNode()->getAggregated();
+    }
+
+    /**
+     * Get last key in the leaf node containing the current iterator
+     * location.  Iterator must be valid.
+     */
+    const KeyType &
+    getLeafLastKey() const
+    {
+        return _leaf.getNode()->getLastKey();
+    }
+
     /**
      * Return the number of elements in the tree.
      */
@@ -19,6 +19,13 @@ namespace {
 
 void verifyContains(const search::BitVector & a, const search::BitVector & b) __attribute__((noinline));
 
+const IAccelrated &
+accelrator()
+{
+    static IAccelrated::UP accel(IAccelrated::getAccelrator());
+    return *accel;
+}
+
 void verifyContains(const search::BitVector & a, const search::BitVector & b)
 {
     if ((a.getStartIndex() < b.getStartIndex()) || (a.size() > b.size())) {
@@ -135,11 +142,7 @@ BitVector::count() const
 BitVector::Index
 BitVector::internalCount(const Word *tarr, size_t sz)
 {
-    Index count(0);
-    for (size_t i(0); i < sz; i++) {
-        count += Optimized::popCount(tarr[i]);
-    }
-    return count;
+    return accelrator().populationCount(tarr, sz);
 }
 
 BitVector::Index
@@ -185,7 +188,7 @@ void
 BitVector::orWith(const BitVector & right)
 {
     verifyContains(*this, right);
-    IAccelrated::getAccelrator()->orBit(getActiveStart(), right.getWordIndex(getStartIndex()), getActiveBytes());
+    accelrator().orBit(getActiveStart(), right.getWordIndex(getStartIndex()), getActiveBytes());
 
     repairEnds();
     invalidateCachedCount();
@@ -208,7 +211,7 @@ BitVector::andWith(const BitVector & right)
 {
     verifyContains(*this, right);
 
-    IAccelrated::getAccelrator()->andBit(getActiveStart(), right.getWordIndex(getStartIndex()), getActiveBytes());
+    accelrator().andBit(getActiveStart(), right.getWordIndex(getStartIndex()), getActiveBytes());
 
     setGuardBit();
     invalidateCachedCount();
@@ -220,7 +223,7 @@ BitVector::andNotWith(const BitVector& right)
 {
     verifyContains(*this, right);
 
-    IAccelrated::getAccelrator()->andNotBit(getActiveStart(), right.getWordIndex(getStartIndex()), getActiveBytes());
+    accelrator().andNotBit(getActiveStart(), right.getWordIndex(getStartIndex()), getActiveBytes());
 
     setGuardBit();
     invalidateCachedCount();
@@ -228,7 +231,7 @@ BitVector::andNotWith(const BitVector& right)
 
 void
 BitVector::notSelf() {
-    IAccelrated::getAccelrator()->notBit(getActiveStart(), getActiveBytes());
+    accelrator().notBit(getActiveStart(), getActiveBytes());
     setGuardBit();
     invalidateCachedCount();
 }
@@ -0,0 +1,305 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "lockfreesequencedtaskexecutor.h"
+#include <vespa/vespalib/util/runnable.h>
+#include <vespa/vespalib/util/thread.h>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using vespalib::Executor;
+
+namespace search {
+
+namespace {
+
+// Number of times a thread checks for progress, yielding in between,
+// before it goes to sleep.
+constexpr uint32_t spinRounds = 100;
+
+constexpr uint32_t maxBatchSize = 64;
+
+constexpr size_t cacheLineSize = 64;
+
+uint64_t
+roundUpToPowerOf2(uint64_t value)
+{
+    uint64_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}
+
+/**
+ * A single worker thread with a bounded multi-producer single-consumer
+ * ring buffer of tasks. Each slot has a sequence number telling if it
+ * is free to be written by the producer claiming position pos (sequence
+ * == pos) or holds a task ready to be run (sequence == pos + 1).
+ */
+class LockFreeSequencedTaskExecutor::Worker : public vespalib::Runnable
+{
+    struct Slot {
+        std::atomic<uint64_t> sequence;
+        Executor::Task       *task;
+    };
+
+    const uint64_t          _mask;
+    std::unique_ptr<Slot[]> _slots;
+    alignas(cacheLineSize) std::atomic<uint64_t> _head; // next position claimed by a producer
+    alignas(cacheLineSize) uint64_t              _tail; // next position run by the worker
+    std::atomic<uint64_t>   _done;    // number of tasks run
+    std::atomic<bool>       _sleeping;
+    std::atomic<uint32_t>   _waiters; // producers waiting for space, and syncers
+    alignas(cacheLineSize) std::mutex _lock;
+    std::condition_variable _wakeupCond;
+    std::condition_variable _progressCond;
+    bool                    _stopped;
+    vespalib::Thread        _thread;
+
+    bool tryPush(Executor::Task *task);
+    bool full() const;
+    bool hasTask() const;
+    uint32_t drain(std::vector<Executor::Task *> &batch);
+    bool waitForTask();
+    void waitForSpace();
+    void notifyWaiters();
+
+public:
+    Worker(uint32_t taskLimit);
+    ~Worker();
+    void push(Executor::Task::UP task);
+    void sync();
+    void run() override;
+};
+
+LockFreeSequencedTaskExecutor::Worker::Worker(uint32_t taskLimit)
+    : _mask(roundUpToPowerOf2(taskLimit) - 1),
+      _slots(new Slot[_mask + 1]),
+      _head(0),
+      _tail(0),
+      _done(0),
+      _sleeping(false),
+      _waiters(0),
+      _lock(),
+      _wakeupCond(),
+      _progressCond(),
+      _stopped(false),
+      _thread(*this)
+{
+    for (uint64_t pos = 0; pos <= _mask; ++pos) {
+        _slots[pos].sequence.store(pos, std::memory_order_relaxed);
+        _slots[pos].task = nullptr;
+    }
+    _thread.start();
+}
+
+LockFreeSequencedTaskExecutor::Worker::~Worker()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stopped = true;
+    }
+    _wakeupCond.notify_one();
+    _thread.join();
+}
+
+bool
+LockFreeSequencedTaskExecutor::Worker::tryPush(Executor::Task *task)
+{
+    uint64_t pos = _head.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot &slot = _slots[pos & _mask];
+        int64_t diff = int64_t(slot.sequence.load(std::memory_order_acquire)) - int64_t(pos);
+        if (diff == 0) {
+            if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.task = task;
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = _head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool
+LockFreeSequencedTaskExecutor::Worker::full() const
+{
+    uint64_t pos = _head.load(std::memory_order_relaxed);
+    return _slots[pos & _mask].sequence.load(std::memory_order_acquire) < pos;
+}
+
+bool
+LockFreeSequencedTaskExecutor::Worker::hasTask() const
+{
+    return _slots[_tail & _mask].sequence.load(std::memory_order_acquire) == _tail + 1;
+}
+
+uint32_t
+LockFreeSequencedTaskExecutor::Worker::drain(std::vector<Executor::Task *> &batch)
+{
+    while (batch.size() < maxBatchSize && hasTask()) {
+        Slot &slot = _slots[_tail & _mask];
+        batch.push_back(slot.task);
+        slot.sequence.store(_tail + _mask + 1, std::memory_order_release);
+        ++_tail;
+    }
+    return batch.size();
+}
+
+bool
+LockFreeSequencedTaskExecutor::Worker::waitForTask()
+{
+    for (uint32_t round = 0; round < spinRounds; ++round) {
+        if (hasTask()) {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> guard(_lock);
+    _sleeping.store(true, std::memory_order_relaxed);
+    // Pairs with the fence in push(): either we see the task or the
+    // producer sees that we are sleeping.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!hasTask() && !_stopped) {
+        _wakeupCond.wait(guard);
+    }
+    _sleeping.store(false, std::memory_order_relaxed);
+    return hasTask();
+}
+
+void
+LockFreeSequencedTaskExecutor::Worker::waitForSpace()
+{
+    for (uint32_t round = 0; round < spinRounds; ++round) {
+        if (!full()) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> guard(_lock);
+    _waiters.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (full()) {
+        _progressCond.wait(guard);
+    }
+    _waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void
+LockFreeSequencedTaskExecutor::Worker::notifyWaiters()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_waiters.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> guard(_lock);
+        _progressCond.notify_all();
+    }
+}
+
+void
+LockFreeSequencedTaskExecutor::Worker::push(Executor::Task::UP task)
+{
+    Executor::Task *rawTask = task.release();
+    while (!tryPush(rawTask)) {
+        waitForSpace();
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_sleeping.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> guard(_lock);
+        _wakeupCond.notify_one();
+    }
+}
+
+void
+LockFreeSequencedTaskExecutor::Worker::sync()
+{
+    uint64_t target = _head.load(std::memory_order_acquire);
+    for (uint32_t round = 0; round < spinRounds; ++round) {
+        if (_done.load(std::memory_order_acquire) >= target) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> guard(_lock);
+    _waiters.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (_done.load(std::memory_order_acquire) < target) {
+        _progressCond.wait(guard);
+    }
+    _waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void
+LockFreeSequencedTaskExecutor::Worker::run()
+{
+    std::vector<Executor::Task *> batch;
+    batch.reserve(maxBatchSize);
+    for (;;) {
+        if (drain(batch) == 0) {
+            if (!waitForTask()) {
+                break;
+            }
+            continue;
+        }
+        // Slots of the batch are free again, let blocked producers continue
+        notifyWaiters();
+        for (Executor::Task *task : batch) {
+            Executor::Task::UP(task)->run();
+        }
+        _done.store(_done.load(std::memory_order_relaxed) + batch.size(), std::memory_order_release);
+        batch.clear();
+        notifyWaiters();
+    }
+}
+
+
+LockFreeSequencedTaskExecutor::LockFreeSequencedTaskExecutor(uint32_t threads, uint32_t taskLimit)
+    : _workers(),
+      _ids()
+{
+    for (uint32_t id = 0; id < threads; ++id) {
+        _workers.push_back(std::make_unique<Worker>(taskLimit));
+    }
+}
+
+LockFreeSequencedTaskExecutor::~LockFreeSequencedTaskExecutor()
+{
+    sync();
+}
+
+uint32_t
+LockFreeSequencedTaskExecutor::getExecutorId(uint64_t componentId)
+{
+    auto itr = _ids.find(componentId);
+    if (itr == _ids.end()) {
+        auto insarg = std::make_pair(componentId, _ids.size() % _workers.size());
+        auto insres = _ids.insert(insarg);
+        assert(insres.second);
+        itr = insres.first;
+    }
+    return itr->second;
+}
+
+void
+LockFreeSequencedTaskExecutor::executeTask(uint32_t executorId, Executor::Task::UP task)
+{
+    assert(executorId < _workers.size());
+    _workers[executorId]->push(std::move(task));
+}
+
+void
+LockFreeSequencedTaskExecutor::sync()
+{
+    for (auto &worker : _workers) {
+        worker->sync();
+    }
+}
+
+} // namespace search
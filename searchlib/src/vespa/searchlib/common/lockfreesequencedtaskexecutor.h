@@ -0,0 +1,48 @@
+// Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#pragma once
+
+#include "isequencedtaskexecutor.h"
+#include <vespa/vespalib/stllike/hash_map.h>
+#include <vector>
+
+namespace search
+{
+
+/**
+ * Class to run multiple tasks in parallel, but tasks with same
+ * id has to be run in sequence.
+ *
+ * Same contract as SequencedTaskExecutor, but each worker thread
+ * takes its tasks from a bounded lock-free ring buffer that can be
+ * filled by multiple producers. The worker drains all available
+ * tasks in one go and runs them as a batch, and it spins for a
+ * short while before going to sleep when it runs out of tasks.
+ * Handing over a task to a busy worker is thus a couple of atomic
+ * operations, instead of a mutex and condition handoff per task.
+ * Producers block while the ring buffer of a worker is full.
+ */
+class LockFreeSequencedTaskExecutor : public ISequencedTaskExecutor
+{
+    class Worker;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    vespalib::hash_map<size_t, size_t> _ids;
+public:
+    using ISequencedTaskExecutor::getExecutorId;
+
+    /**
+     * @param threads   number of worker threads
+     * @param taskLimit number of pending tasks per worker before
+     *                  producers block, rounded up to a power of 2
+     */
+    LockFreeSequencedTaskExecutor(uint32_t threads, uint32_t taskLimit = 1000);
+
+    ~LockFreeSequencedTaskExecutor();
+
+    virtual uint32_t getExecutorId(uint64_t componentId) override;
+
+    virtual void executeTask(uint32_t executorId, vespalib::Executor::Task::UP task) override;
+
+    virtual void sync() override;
+};
+
+} // namespace search
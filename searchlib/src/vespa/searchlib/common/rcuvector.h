@@ -100,6 +100,12 @@ public:
     void unsafe_resize(size_t n);
     void unsafe_reserve(size_t n);
     void ensure_size(size_t n, T fill = T());
+    /**
+     * Replace the vector with the first n elements stored in the
+     * given buffer. The capacity is given by the size of the buffer.
+     * NOTE: Unsafe, assumes no readers (like reset()).
+     **/
+    void unsafe_adopt(Alloc &&buf, size_t n);
     void reserve(size_t n) {
         if (n > capacity()) {
             expand(calcNewSize(n));
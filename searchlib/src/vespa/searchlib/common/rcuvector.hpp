@@ -38,6 +38,13 @@ RcuVectorBase<T>::ensure_size(size_t n, T fill) {
     }
 }
 
+template <typename T>
+void
+RcuVectorBase<T>::unsafe_adopt(Alloc &&buf, size_t n) {
+    assert(n * sizeof(T) <= buf.size());
+    Array(std::move(buf), n).swap(_data);
+}
+
 template <typename T>
 void
 RcuVectorBase<T>::reset() {
@@ -10,6 +10,9 @@
 #include <vespa/vespalib/io/fileutil.h>
 #include <vespa/searchlib/common/documentsummary.h>
 #include <vespa/vespalib/util/error.h>
+#include <vespa/vespalib/util/threadstackexecutor.h>
+#include <vespa/searchlib/common/lambdatask.h>
+#include <vespa/fastos/time.h>
 #include <sstream>
 
 #include <vespa/log/log.h>
@@ -44,9 +47,9 @@ Fusion::Fusion(bool dynamicKPosIndexFormat,
     : _schema(NULL),
       _oldIndexes(),
       _docIdLimit(0u),
-      _numWordIds(0u),
       _dynamicKPosIndexFormat(dynamicKPosIndexFormat),
       _outDir("merged"),
+      _numThreads(1u),
       _tuneFileIndexing(tuneFileIndexing),
       _fileHeaderContext(fileHeaderContext)
 { }
@@ -54,7 +57,6 @@ Fusion::Fusion(bool dynamicKPosIndexFormat,
 
 Fusion::~Fusion()
 {
-    ReleaseMappingTables();
 }
 
 
@@ -72,6 +74,13 @@ Fusion::setOutDir(const vespalib::string &outDir)
 }
 
 
+void
+Fusion::setNumThreads(uint32_t numThreads)
+{
+    _numThreads = std::max(1u, numThreads);
+}
+
+
 void
 Fusion::SetOldIndexList(const std::vector<vespalib::string> &oldIndexList)
 {
@@ -104,9 +113,8 @@ Fusion::openInputWordReaders(const SchemaUtil::IndexIterator &index,
     for (auto &i : getOldIndexes()) {
         OldIndex &oi = *i;
         auto reader(std::make_unique<DictionaryWordReader>());
-        const vespalib::string &tmpindexpath = oi.getTmpPath();
         const vespalib::string &oldindexpath = oi.getPath();
-        vespalib::string wordMapName = tmpindexpath + "/old2new.dat";
+        vespalib::string wordMapName = getWordMapName(oi, index);
         vespalib::string fieldDir(oldindexpath + "/" + index.getName());
         vespalib::string dictName(fieldDir + "/dictionary");
         const Schema &oldSchema = oi.getSchema();
@@ -132,7 +140,9 @@ Fusion::openInputWordReaders(const SchemaUtil::IndexIterator &index,
 
 
 bool
-Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index)
+Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index,
+                             WordNumMappings &wordNumMappings,
+                             uint64_t &numWordIds)
 {
     vespalib::string indexName = index.getName();
     LOG(debug, "Renumber word IDs for field %s", indexName.c_str());
@@ -147,7 +157,7 @@ Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index)
 
     heap.merge(out, 4);
     assert(heap.empty());
-    _numWordIds = out.getWordNum();
+    numWordIds = out.getWordNum();
 
     // Close files
     for (auto &i : readers) {
@@ -156,7 +166,7 @@ Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index)
 
     // Now read mapping files back into an array
     // XXX: avoid this, and instead make the array here
-    if (!ReadMappingFiles(&index))
+    if (!ReadMappingFiles(index, wordNumMappings))
         return false;
 
     LOG(debug, "Finished renumbering words IDs for field %s",
@@ -169,13 +179,40 @@ Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index)
 bool
 Fusion::mergeFields()
 {
-   typedef SchemaUtil::IndexIterator IndexIterator;
+    typedef SchemaUtil::IndexIterator IndexIterator;
 
     const Schema &schema = getSchema();
+    std::vector<uint32_t> ids;
     for (IndexIterator index(schema); index.isValid(); ++index) {
-        if (!mergeField(index.getIndex()))
-            return false;
+        ids.push_back(index.getIndex());
     }
+    FastOS_Time timer;
+    timer.SetNow();
+    makeTmpDirs();
+    uint32_t numThreads = std::min(_numThreads, static_cast<uint32_t>(ids.size()));
+    if (numThreads > 1) {
+        std::vector<uint8_t> results(ids.size(), 0u);
+        vespalib::ThreadStackExecutor executor(numThreads, 128 * 1024);
+        for (size_t i = 0; i < ids.size(); ++i) {
+            executor.execute(makeLambdaTask([this, &ids, &results, i]()
+                                            { results[i] = mergeField(ids[i]) ? 1u : 0u; }));
+        }
+        executor.sync();
+        for (auto result : results) {
+            if (result == 0u)
+                return false;
+        }
+    } else {
+        for (uint32_t id : ids) {
+            if (!mergeField(id))
+                return false;
+        }
+    }
+    if (!CleanTmpDirs())
+        return false;
+    LOG(info, "Merged %zu fields into %s using %u threads in %.3f seconds",
+        ids.size(), _outDir.c_str(), std::max(1u, numThreads),
+        timer.MilliSecsToNow() / 1000.0);
     return true;
 }
 
@@ -202,16 +239,18 @@ Fusion::mergeField(uint32_t id)
     LOG(debug, "mergeField for field %s dir %s",
         indexName.c_str(), indexDir.c_str());
 
-    makeTmpDirs();
-
-    if (!renumberFieldWordIds(index)) {
+    FastOS_Time timer;
+    timer.SetNow();
+    WordNumMappings wordNumMappings(_oldIndexes.size());
+    uint64_t numWordIds = 0u;
+    if (!renumberFieldWordIds(index, wordNumMappings, numWordIds)) {
         LOG(error, "Could not renumber field word ids for field %s dir %s",
             indexName.c_str(), indexDir.c_str());
         return false;
     }
 
     // Tokamak
-    bool res = mergeFieldPostings(index);
+    bool res = mergeFieldPostings(index, wordNumMappings, numWordIds);
     if (!res) {
         LOG(error, "Could not merge field postings for field %s dir %s",
             indexName.c_str(), indexDir.c_str());
@@ -220,11 +259,11 @@ Fusion::mergeField(uint32_t id)
     if (!FileKit::createStamp(indexDir +  "/.mergeocc_done"))
         return false;
 
-    if (!CleanTmpDirs())
-        return false;
-
-    LOG(debug, "Finished mergeField for field %s dir %s",
-        indexName.c_str(), indexDir.c_str());
+    double elapsed = timer.MilliSecsToNow() / 1000.0;
+    LOG(debug, "Finished mergeField for field %s dir %s, "
+        "%" PRIu64 " words in %.3f seconds (%.0f words/s)",
+        indexName.c_str(), indexDir.c_str(), numWordIds, elapsed,
+        (elapsed > 0.0) ? numWordIds / elapsed : 0.0);
 
     return true;
 }
@@ -286,18 +325,19 @@ Fusion::selectCookedOrRawFeatures(Reader &reader, Writer &writer)
 
 bool
 Fusion::openInputFieldReaders(const SchemaUtil::IndexIterator &index,
+                              const WordNumMappings &wordNumMappings,
                               std::vector<std::unique_ptr<FieldReader> > &
                               readers)
 {
     vespalib::string indexName = index.getName();
-    for (auto &i : _oldIndexes) {
-        OldIndex &oi = *i;
+    for (size_t i = 0; i < _oldIndexes.size(); ++i) {
+        OldIndex &oi = *_oldIndexes[i];
         const Schema &oldSchema = oi.getSchema();
         if (!index.hasOldFields(oldSchema, false)) {
             continue; // drop data
         }
         auto reader = FieldReader::allocFieldReader(index, oldSchema);
-        reader->setup(oi.getWordNumMapping(),
+        reader->setup(wordNumMappings[i],
                       oi.getDocIdMapping());
         if (!reader->open(oi.getPath() + "/" +
                           indexName + "/",
@@ -353,15 +393,17 @@ Fusion::setupMergeHeap(const std::vector<std::unique_ptr<FieldReader> > &
 
 
 bool
-Fusion::mergeFieldPostings(const SchemaUtil::IndexIterator &index)
+Fusion::mergeFieldPostings(const SchemaUtil::IndexIterator &index,
+                           const WordNumMappings &wordNumMappings,
+                           uint64_t numWordIds)
 {
     std::vector<std::unique_ptr<FieldReader>> readers;
     PostingPriorityQueue<FieldReader> heap;
     /* OUTPUT */
-    FieldWriter fieldWriter(_docIdLimit, _numWordIds);
+    FieldWriter fieldWriter(_docIdLimit, numWordIds);
     vespalib::string indexName = index.getName();
 
-    if (!openInputFieldReaders(index, readers))
+    if (!openInputFieldReaders(index, wordNumMappings, readers))
         return false;
     if (!openFieldWriter(index, fieldWriter))
         return false;
@@ -384,16 +426,24 @@ Fusion::mergeFieldPostings(const SchemaUtil::IndexIterator &index)
 }
 
 
-bool
-Fusion::ReadMappingFiles(const SchemaUtil::IndexIterator *index)
+vespalib::string
+Fusion::getWordMapName(const FusionInputIndex &oldIndex,
+                       const SchemaUtil::IndexIterator &index)
 {
-    ReleaseMappingTables();
+    return oldIndex.getTmpPath() + "/old2new." + index.getName() + ".dat";
+}
 
+
+bool
+Fusion::ReadMappingFiles(const SchemaUtil::IndexIterator &index,
+                         WordNumMappings &wordNumMappings)
+{
     size_t numberOfOldIndexes = _oldIndexes.size();
+    assert(wordNumMappings.size() == numberOfOldIndexes);
     for (uint32_t i = 0; i < numberOfOldIndexes; i++)
     {
         OldIndex &oi = *_oldIndexes[i];
-        WordNumMapping &wordNumMapping = oi.getWordNumMapping();
+        WordNumMapping &wordNumMapping = wordNumMappings[i];
         std::vector<uint32_t> oldIndexes;
         const Schema &oldSchema = oi.getSchema();
         if (!SchemaUtil::getIndexIds(oldSchema,
@@ -404,12 +454,12 @@ Fusion::ReadMappingFiles(const SchemaUtil::IndexIterator *index)
             wordNumMapping.noMappingFile();
             continue;
         }
-        if (index && !index->hasOldFields(oldSchema, false)) {
+        if (!index.hasOldFields(oldSchema, false)) {
             continue; // drop data
         }
 
         // Open word mapping file
-        vespalib::string old2newname = oi.getTmpPath() + "/old2new.dat";
+        vespalib::string old2newname = getWordMapName(oi, index);
         wordNumMapping.readMappingFile(old2newname, _tuneFileIndexing._read);
     }
 
@@ -417,19 +467,6 @@ Fusion::ReadMappingFiles(const SchemaUtil::IndexIterator *index)
 }
 
 
-bool
-Fusion::ReleaseMappingTables()
-{
-    size_t numberOfOldIndexes = _oldIndexes.size();
-    for (uint32_t i = 0; i < numberOfOldIndexes; i++)
-    {
-        OldIndex &oi = *_oldIndexes[i];
-        oi.getWordNumMapping().clear();
-    }
-    return true;
-}
-
-
 void
 Fusion::makeTmpDirs()
 {
@@ -517,7 +554,8 @@ Fusion::merge(const Schema &schema,
               const SelectorArray &selector,
               bool dynamicKPosOccFormat,
               const TuneFileIndexing &tuneFileIndexing,
-              const FileHeaderContext &fileHeaderContext)
+              const FileHeaderContext &fileHeaderContext,
+              uint32_t numThreads)
 {
     assert(sources.size() <= 255);
     uint32_t docIdLimit = selector.size();
@@ -560,6 +598,7 @@ Fusion::merge(const Schema &schema,
                                          fileHeaderContext));
     fusion->setSchema(&schema);
     fusion->setOutDir(dir);
+    fusion->setNumThreads(numThreads);
     fusion->SetOldIndexList(sources);
     if (!fusion->readSchemaFiles()) {
         LOG(error, "Cannot read schema files for source indexes");
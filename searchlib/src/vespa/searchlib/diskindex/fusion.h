@@ -39,7 +39,6 @@ public:
     typedef diskindex::DocIdMapping DocIdMapping;
 private:
     vespalib::string _path;
-    WordNumMapping _wordNumMapping;
     DocIdMapping _docIdMapping;
     vespalib::string _tmpPath;
     index::Schema::SP _schema;
@@ -47,7 +46,6 @@ private:
 public:
     FusionInputIndex()
         : _path(),
-          _wordNumMapping(),
           _docIdMapping(),
           _tmpPath(),
           _schema()
@@ -83,18 +81,6 @@ public:
         return _tmpPath;
     }
 
-    const WordNumMapping &
-    getWordNumMapping() const
-    {
-        return _wordNumMapping;
-    }
-
-    WordNumMapping &
-    getWordNumMapping()
-    {
-        return _wordNumMapping;
-    }
-
     const DocIdMapping &
     getDocIdMapping() const
     {
@@ -139,9 +125,12 @@ public:
 
     void SetOldIndexList(const std::vector<vespalib::string> &oldIndexList);
 
+    typedef std::vector<WordNumMapping> WordNumMappings;
+
     bool mergeFields();
     bool mergeField(uint32_t id);
     bool openInputFieldReaders(const SchemaUtil::IndexIterator &index,
+                               const WordNumMappings &wordNumMappings,
                                std::vector<std::unique_ptr<FieldReader> > &
                                readers);
     bool openFieldWriter(const SchemaUtil::IndexIterator &index,
@@ -150,13 +139,17 @@ public:
                         readers,
                         FieldWriter &writer,
                         PostingPriorityQueue<FieldReader> &heap);
-    bool mergeFieldPostings(const SchemaUtil::IndexIterator &index);
+    bool mergeFieldPostings(const SchemaUtil::IndexIterator &index,
+                            const WordNumMappings &wordNumMappings,
+                            uint64_t numWordIds);
     bool openInputWordReaders(const SchemaUtil::IndexIterator &index,
                               std::vector<
                                  std::unique_ptr<DictionaryWordReader> > &
                               readers,
                               PostingPriorityQueue<DictionaryWordReader> &heap);
-    bool renumberFieldWordIds(const SchemaUtil::IndexIterator &index);
+    bool renumberFieldWordIds(const SchemaUtil::IndexIterator &index,
+                              WordNumMappings &wordNumMappings,
+                              uint64_t &numWordIds);
 
     void
     setSchema(const Schema *schema);
@@ -164,6 +157,12 @@ public:
     void
     setOutDir(const vespalib::string &outDir);
 
+    /*
+     * Set number of threads used to merge fields in parallel.
+     */
+    void
+    setNumThreads(uint32_t numThreads);
+
     void makeTmpDirs();
 
     bool CleanTmpDirs();
@@ -179,8 +178,17 @@ public:
     selectCookedOrRawFeatures(Reader &reader, Writer &writer);
 
 protected:
-    bool ReadMappingFiles(const SchemaUtil::IndexIterator *index);
-    bool ReleaseMappingTables();
+    /*
+     * Get name of file mapping old to new word numbers for a field in an
+     * old index.  Each field has its own file, since fields can be merged
+     * in parallel.
+     */
+    static vespalib::string
+    getWordMapName(const FusionInputIndex &oldIndex,
+                   const SchemaUtil::IndexIterator &index);
+
+    bool ReadMappingFiles(const SchemaUtil::IndexIterator &index,
+                          WordNumMappings &wordNumMappings);
 
     static unsigned int noGen()
     {
@@ -199,7 +207,6 @@ protected:
     // OUTPUT:
 
     uint32_t _docIdLimit;
-    uint64_t _numWordIds;
 
     // Index format parameters.
     bool _dynamicKPosIndexFormat;
@@ -211,6 +218,8 @@ protected:
      */
     vespalib::string _outDir;
 
+    uint32_t _numThreads;
+
     const TuneFileIndexing &_tuneFileIndexing;
     const search::common::FileHeaderContext &_fileHeaderContext;
 
@@ -228,12 +237,6 @@ public:
         _docIdLimit = docIdLimit;
     }
 
-    void
-    setNumWordIds(uint64_t numWordIds)
-    {
-        _numWordIds = numWordIds;
-    }
-
     std::vector<std::shared_ptr<OldIndex> > &
     getOldIndexes()
     {
@@ -248,6 +251,7 @@ public:
 
     /**
      * This method is used by new indexing pipeline to merge indexes.
+     * Fields are merged in parallel when numThreads > 1.
      */
     static bool
     merge(const Schema &schema,
@@ -256,7 +260,8 @@ public:
           const SelectorArray &docIdSelector,
           bool dynamicKPosOccFormat,
           const TuneFileIndexing &tuneFileIndexing,
-          const search::common::FileHeaderContext &fileHeaderContext);
+          const search::common::FileHeaderContext &fileHeaderContext,
+          uint32_t numThreads = 1);
 };
 
 } // namespace diskindex
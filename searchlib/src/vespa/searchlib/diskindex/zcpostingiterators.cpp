@@ -208,6 +208,7 @@ ZcPostingIteratorBase::ZcPostingIteratorBase(const TermFieldMatchDataArray &matc
     : ZcIteratorBase(matchData, start, docIdLimit),
       _valI(NULL),
       _valIBase(NULL),
+      _valIEnd(NULL),
       _featureSeekPos(0),
       _l1(),
       _l2(),
@@ -312,6 +313,7 @@ ZcPostingIterator<bigEndian>::readWordStart(uint32_t docIdLimit)
     const uint8_t *bcompr = d.getByteCompr();
     _valIBase = _valI = bcompr;
     bcompr += docIdsSize;
+    _valIEnd = bcompr;
     _l1.setup(prevDocId, _chunk._lastDocId, bcompr, l1SkipSize);
     _l2.setup(prevDocId, _chunk._lastDocId, bcompr, l2SkipSize);
     _l3.setup(prevDocId, _chunk._lastDocId, bcompr, l3SkipSize);
@@ -543,6 +545,11 @@ ZcPostingIteratorBase::doSeek(uint32_t docId)
 #endif
     const uint8_t *oCompr = _valI;
     while (__builtin_expect(oDocId < docId, true)) {
+        if (_valIEnd - oCompr >= static_cast<ptrdiff_t>(ZC_BLOCK_SKIP_SIZE) &&
+            zcBlockSkip(oCompr, oDocId, docId)) {
+            incNeedUnpack(ZC_BLOCK_SKIP_SIZE);
+            continue;
+        }
 #if DEBUG_ZCPOSTING_ASSERT
         assert(oDocId <= _l1._skipDocId);
         assert(oDocId <= _l2._skipDocId);
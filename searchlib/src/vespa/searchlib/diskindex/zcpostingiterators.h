@@ -6,6 +6,7 @@
 #include <vespa/searchlib/bitcompression/compression.h>
 #include <vespa/searchlib/queryeval/iterators.h>
 #include <vespa/fastos/dynamiclibrary.h>
+#include <cstring>
 
 namespace search {
 
@@ -43,6 +44,40 @@ do {									\
     }									\
 } while (0)
 
+/**
+ * Number of docid deltas handled at once by ZcBlockSkip.
+ */
+constexpr size_t ZC_BLOCK_SKIP_SIZE = 8;
+
+/**
+ * Try to skip a block of ZC_BLOCK_SKIP_SIZE docid deltas that are all
+ * encoded as single bytes, which is the common case for dense posting
+ * lists. The block is only skipped if the last docid in it is less
+ * than or equal to docId. Returns true if the block was skipped, and
+ * false if the caller must fall back to decoding one delta at a time.
+ * The caller must ensure that valI + ZC_BLOCK_SKIP_SIZE is within
+ * the docid deltas.
+ */
+inline bool
+zcBlockSkip(const uint8_t *&valI, uint32_t &prevDocId, uint32_t docId)
+{
+    uint64_t block;
+    memcpy(&block, valI, sizeof(block));
+    if ((block & 0x8080808080808080ul) != 0) {
+        return false;
+    }
+    // Byte order does not matter when summing all bytes
+    uint64_t pairs = (block & 0x00ff00ff00ff00fful) + ((block >> 8) & 0x00ff00ff00ff00fful);
+    uint32_t sum = (pairs * 0x0001000100010001ul) >> 48;
+    uint32_t lastDocId = prevDocId + ZC_BLOCK_SKIP_SIZE + sum;
+    if (lastDocId > docId) {
+        return false;
+    }
+    prevDocId = lastDocId;
+    valI += ZC_BLOCK_SKIP_SIZE;
+    return true;
+}
+
 class ZcIteratorBase : public queryeval::RankedSearchIteratorBase
 {
 protected:
@@ -108,6 +143,7 @@ class ZcPostingIteratorBase : public ZcIteratorBase
 protected:
     const uint8_t *_valI;     // docid deltas
     const uint8_t *_valIBase; // start of docid deltas
+    const uint8_t *_valIEnd;  // end of docid deltas
     uint64_t _featureSeekPos;
 
     // Helper class for L1 skip info
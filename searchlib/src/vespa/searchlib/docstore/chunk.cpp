@@ -48,10 +48,11 @@ Chunk::getMaxPackSize(const document::CompressionConfig & compression) const {
 }
 
 void
-Chunk::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, const document::CompressionConfig & compression)
+Chunk::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, const document::CompressionConfig & compression,
+            const document::ZStdDictionary * dictionary)
 {
     _lastSerial = lastSerial;
-    _format->pack(_lastSerial, compressed, compression);
+    _format->pack(_lastSerial, compressed, compression, dictionary);
 }
 
 Chunk::Chunk(uint32_t id, const Config & config) :
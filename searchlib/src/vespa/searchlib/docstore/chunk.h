@@ -13,6 +13,8 @@ namespace vespalib {
     class DataBuffer;
 }
 
+namespace document { class ZStdDictionary; }
+
 namespace search {
 
 class ChunkFormat;
@@ -94,7 +96,8 @@ public:
     const LidList & getLids() const { return _lids; }
     LidList getUniqueLids() const;
     size_t getMaxPackSize(const document::CompressionConfig & compression) const;
-    void pack(uint64_t lastSerial, vespalib::DataBuffer & buffer, const document::CompressionConfig & compression);
+    void pack(uint64_t lastSerial, vespalib::DataBuffer & buffer, const document::CompressionConfig & compression,
+              const document::ZStdDictionary * dictionary = nullptr);
     uint64_t getLastSerial() const { return _lastSerial; }
     uint32_t getId() const { return _id; }
     bool validSerial() const { return getLastSerial() != static_cast<uint64_t>(-1l); }
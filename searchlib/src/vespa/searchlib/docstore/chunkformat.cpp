@@ -19,7 +19,8 @@ ChunkException::ChunkException(const vespalib::stringref & msg, const vespalib::
 }
 
 void
-ChunkFormat::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, const CompressionConfig & compression)
+ChunkFormat::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, const CompressionConfig & compression,
+                  const document::ZStdDictionary * dictionary)
 {
     vespalib::nbostream & os = _dataBuf;
     os << lastSerial;
@@ -33,7 +34,7 @@ ChunkFormat::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, const
     const size_t oldPos(compressed.getDataLen());
     compressed.writeInt8(compression.type);
     compressed.writeInt32(os.size());
-    CompressionConfig::Type type(compress(compression, vespalib::ConstBufferRef(os.c_str(), os.size()), compressed, false));
+    CompressionConfig::Type type(compress(compression, dictionary, vespalib::ConstBufferRef(os.c_str(), os.size()), compressed, false));
     if (compression.type != type) {
         compressed.getData()[oldPos] = type;
     }
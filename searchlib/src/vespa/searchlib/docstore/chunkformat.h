@@ -7,6 +7,8 @@
 #include <vespa/vespalib/data/databuffer.h>
 #include <vespa/vespalib/util/exception.h>
 
+namespace document { class ZStdDictionary; }
+
 namespace search {
 
 class ChunkException : public vespalib::Exception
@@ -29,8 +31,10 @@ public:
      * @param lastSerial The last serial number of any entry in the packet.
      * @param compressed The buffer where the serialized data shall be placed.
      * @param compression What kind of compression shall be employed.
+     * @param dictionary Optional dictionary used for zstd compression.
      */
-    void pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, const document::CompressionConfig & compression);
+    void pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, const document::CompressionConfig & compression,
+              const document::ZStdDictionary * dictionary = nullptr);
     /**
      * Will deserialize and create a representation of the uncompressed data.
      * param buffer Pointer to the serialized data
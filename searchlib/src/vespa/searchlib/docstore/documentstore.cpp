@@ -90,8 +90,10 @@ public:
     void set(vespalib::DataBuffer &&buf, ssize_t len, const CompressionConfig &compression);
 
     /**
-     * Decompress value into temporary buffer and deserialize document from
-     * the temporary buffer.
+     * Decompress value into a buffer that is handed over to the deserialized
+     * document, so its fields can reference it instead of copying. When the
+     * value is not compressed the buffer still belongs to this value, and the
+     * document makes its own copies.
      */
     document::Document::UP deserializeDocument(const DocumentTypeRepo &repo);
 
@@ -148,8 +150,7 @@ document::Document::UP
 Value::deserializeDocument(const DocumentTypeRepo &repo) {
     vespalib::DataBuffer uncompressed((char *) _buf.get(), (size_t) 0);
     decompress(getCompression(), getUncompressedSize(), vespalib::ConstBufferRef(*this, size()), uncompressed, true);
-    vespalib::nbostream is(uncompressed.getData(), uncompressed.getDataLen());
-    return document::Document::UP(new document::Document(repo, is));
+    return document::Document::UP(new document::Document(repo, uncompressed));
 }
 
 
@@ -199,6 +200,7 @@ DocumentStore::DocumentStore(const Config & config, IDataStore & store)
       _uncached_lookups(0)
 {
     _cache->reserveElements(config.getInitialCacheEntries());
+    _cache->maxProbationBytes(config.getMaxCacheBytes() * config.getCacheProbationPercent() / 100);
 }
 
 DocumentStore::~DocumentStore()
@@ -224,6 +226,23 @@ DocumentStore::visit(const LidVector & lids, const DocumentTypeRepo &repo, IDocu
     }
 }
 
+void
+DocumentStore::prefetch(const LidVector & lids) const
+{
+    if (useCache()) {
+        LidVector uncached;
+        uncached.reserve(lids.size());
+        for (DocumentIdT lid : lids) {
+            if ( ! _cache->hasKey(lid)) {
+                uncached.push_back(lid);
+            }
+        }
+        _backingStore.prefetch(uncached);
+    } else {
+        _backingStore.prefetch(lids);
+    }
+}
+
 document::Document::UP
 DocumentStore::read(DocumentIdT lid, const DocumentTypeRepo &repo) const
 {
@@ -500,7 +519,7 @@ DocumentStore::getFileChunkStats() const
 CacheStats DocumentStore::getCacheStats() const {
     CacheStats visitStats = _visitCache->getCacheStats();
     CacheStats singleStats(_cache->getHit(), _cache->getMiss() + _uncached_lookups,
-                           _cache->size(), _cache->sizeBytes());
+                           _cache->size(), _cache->sizeBytes(), _cache->getEvicted());
     singleStats += visitStats;
     return singleStats;
 }
@@ -4,6 +4,7 @@
 
 #include "idocumentstore.h"
 #include "idatastore.h"
+#include <algorithm>
 
 namespace search {
 
@@ -26,27 +27,41 @@ class DocumentStore : public IDocumentStore
 public:
     class Config {
     public:
+        static constexpr uint32_t MAX_CACHE_PROBATION_PERCENT = 90;
         Config() :
             _compression(document::CompressionConfig::LZ4, 9, 70),
             _maxCacheBytes(1000000000),
             _initialCacheEntries(0),
+            _cacheProbationPercent(0),
             _allowVisitCaching(false)
         { }
         Config(const document::CompressionConfig & compression, size_t maxCacheBytes, size_t initialCacheEntries) :
             _compression((maxCacheBytes != 0) ? compression : document::CompressionConfig::NONE),
             _maxCacheBytes(maxCacheBytes),
             _initialCacheEntries(initialCacheEntries),
+            _cacheProbationPercent(0),
             _allowVisitCaching(false)
         { }
         const document::CompressionConfig & getCompression() const { return _compression; }
         size_t getMaxCacheBytes()   const { return _maxCacheBytes; }
         size_t getInitialCacheEntries() const { return _initialCacheEntries; }
+        uint32_t getCacheProbationPercent() const { return _cacheProbationPercent; }
         bool allowVisitCaching() const { return _allowVisitCaching; }
         Config & allowVisitCaching(bool allow) { _allowVisitCaching = allow; return *this; }
+        /**
+         * Percentage of the cache used for documents only read once. They must be read
+         * again to be admitted to the rest of the cache. 0 gives a plain LRU cache.
+         * Capped at MAX_CACHE_PROBATION_PERCENT to leave room for the rest of the cache.
+         */
+        Config & cacheProbationPercent(uint32_t percent) {
+            _cacheProbationPercent = std::min(percent, MAX_CACHE_PROBATION_PERCENT);
+            return *this;
+        }
     private:
         document::CompressionConfig _compression;
         size_t _maxCacheBytes;
         size_t _initialCacheEntries;
+        uint32_t _cacheProbationPercent;
         bool   _allowVisitCaching;
     };
 
@@ -62,6 +77,7 @@ public:
 
     document::Document::UP read(DocumentIdT lid, const document::DocumentTypeRepo &repo) const override;
     void visit(const LidVector & lids, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const override;
+    void prefetch(const LidVector & lids) const override;
     void write(uint64_t synkToken, DocumentIdT lid, const document::Document& doc) override;
     void write(uint64_t synkToken, DocumentIdT lid, const vespalib::nbostream & os) override;
     void remove(uint64_t syncToken, DocumentIdT lid) override;
@@ -55,6 +55,31 @@ FileChunk::createDatFileName(const vespalib::string & name) {
     return name + ".dat";
 }
 
+vespalib::string
+FileChunk::createDictFileName(const vespalib::string & name) {
+    return name + ".dict";
+}
+
+namespace {
+
+document::ZStdDictionary::SP
+readDictionary(const vespalib::string & fileName)
+{
+    FastOS_File file(fileName.c_str());
+    if ( ! file.OpenReadOnly()) {
+        return document::ZStdDictionary::SP();
+    }
+    std::vector<char> content(file.GetSize());
+    file.ReadBuf(&content[0], content.size(), 0);
+    document::ZStdDictionary::SP dictionary(document::ZStdDictionary::create(vespalib::ConstBufferRef(&content[0], content.size())));
+    if ( ! dictionary) {
+        throw SummaryException("Invalid compression dictionary", file, VESPA_STRLOC);
+    }
+    return dictionary;
+}
+
+}
+
 FileChunk::FileChunk(FileId fileId, NameId nameId, const vespalib::string & baseName,
                      const TuneFileSummary & tune, const IBucketizer * bucketizer, bool skipCrcOnRead)
     : _fileId(fileId),
@@ -73,6 +98,7 @@ FileChunk::FileChunk(FileId fileId, NameId nameId, const vespalib::string & base
       _tune(tune),
       _dataFileName(createDatFileName(_name)),
       _idxFileName(createIdxFileName(_name)),
+      _dictionary(readDictionary(createDictFileName(_name))),
       _chunkInfo(),
       _dataHeaderLen(0u),
       _idxHeaderLen(0u),
@@ -153,6 +179,10 @@ FileChunk::erase()
     if (!FastOS_File::Delete(_dataFileName.c_str()) && (errno != ENOENT)) {
         throw std::runtime_error(eraseErrorMsg(_dataFileName, errno));
     }
+    vespalib::string dictFileName(createDictFileName(_name));
+    if (!FastOS_File::Delete(dictFileName.c_str()) && (errno != ENOENT)) {
+        throw std::runtime_error(eraseErrorMsg(dictFileName, errno));
+    }
 }
 
 size_t
@@ -361,6 +391,20 @@ FileChunk::read(LidInfoWithLidV::const_iterator begin, size_t count, ChunkInfo c
     }
 }
 
+void
+FileChunk::prefetch(SubChunkId chunkId) const
+{
+    if (chunkId < _chunkInfo.size()) {
+        prefetchChunk(_chunkInfo[chunkId]);
+    }
+}
+
+void
+FileChunk::prefetchChunk(const ChunkInfo & ci) const
+{
+    _file->prefetch(ci.getOffset(), ci.getSize());
+}
+
 ssize_t
 FileChunk::read(uint32_t lid, SubChunkId chunkId,
                 vespalib::DataBuffer & buffer) const
@@ -542,6 +586,15 @@ FileChunk::eraseDatFile(const vespalib::string & name)
     }
 }
 
+void
+FileChunk::eraseDictFile(const vespalib::string & name)
+{
+    vespalib::string fileName(createDictFileName(name));
+    if ( ! FastOS_File::Delete(fileName.c_str()) && (errno != ENOENT)) {
+        throw std::runtime_error(make_string("Failed to delete '%s'", fileName.c_str()));
+    }
+}
+
 
 DataStoreFileChunkStats
 FileChunk::getStats() const
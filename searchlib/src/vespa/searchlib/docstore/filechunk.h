@@ -7,6 +7,7 @@
 #include "lid_info.h"
 #include "randread.h"
 #include <vespa/searchlib/util/memoryusage.h>
+#include <vespa/document/util/zstdcompressor.h>
 #include <vespa/vespalib/util/ptrholder.h>
 #include <vespa/vespalib/util/sync.h>
 #include <vespa/vespalib/stllike/hash_map.h>
@@ -111,6 +112,7 @@ public:
     virtual size_t updateLidMap(const LockGuard &guard, ISetLid &lidMap, uint64_t serialNum, uint32_t docIdLimit);
     virtual ssize_t read(uint32_t lid, SubChunkId chunk, vespalib::DataBuffer & buffer) const;
     virtual void read(LidInfoWithLidV::const_iterator begin, size_t count, IBufferVisitor & visitor) const;
+    virtual void prefetch(SubChunkId chunk) const;
     void remove(uint32_t lid, uint32_t size);
     virtual size_t getDiskFootprint() const { return _diskFootprint; }
     virtual size_t getMemoryFootprint() const;
@@ -160,6 +162,11 @@ public:
     virtual fastos::TimeStamp getModificationTime() const;
     virtual bool frozen() const { return true; }
     const vespalib::string & getName() const { return _name; }
+    /**
+     * The dictionary used for compressing the chunks in this file, if any.
+     * It is stored in a separate '.dict' file next to the '.dat' and '.idx' files.
+     */
+    const document::ZStdDictionary::SP & getDictionary() const { return _dictionary; }
     void compact(const IGetLid & iGetLid);
     void appendTo(const IGetLid & db, IWriteData & dest, uint32_t numChunks, IFileChunkVisitorProgress *visitorProgress);
     /**
@@ -193,8 +200,10 @@ public:
     static bool isIdxFileEmpty(const vespalib::string & name);
     static void eraseIdxFile(const vespalib::string & name);
     static void eraseDatFile(const vespalib::string & name);
+    static void eraseDictFile(const vespalib::string & name);
     static vespalib::string createIdxFileName(const vespalib::string & name);
     static vespalib::string createDatFileName(const vespalib::string & name);
+    static vespalib::string createDictFileName(const vespalib::string & name);
 private:
     typedef std::unique_ptr<FileRandRead> File;
     void loadChunkInfo();
@@ -232,6 +241,7 @@ protected:
     void setNumUniqueBuckets(size_t numUniqueBuckets) { _numUniqueBuckets = numUniqueBuckets; }
     ssize_t read(uint32_t lid, SubChunkId chunkId, const ChunkInfo & chunkInfo, vespalib::DataBuffer & buffer) const;
     void read(LidInfoWithLidV::const_iterator begin, size_t count, ChunkInfo ci, IBufferVisitor & visitor) const;
+    void prefetchChunk(const ChunkInfo & ci) const;
     static uint32_t readDocIdLimit(vespalib::GenericHeader &header);
     static void writeDocIdLimit(vespalib::GenericHeader &header, uint32_t docIdLimit);
 
@@ -241,6 +251,7 @@ protected:
     TuneFileSummary     _tune;
     vespalib::string    _dataFileName;
     vespalib::string    _idxFileName;
+    document::ZStdDictionary::SP _dictionary;
     ChunkInfoVector     _chunkInfo;
     uint32_t            _dataHeaderLen;
     uint32_t            _idxHeaderLen;
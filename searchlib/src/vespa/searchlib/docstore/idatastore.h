@@ -62,6 +62,14 @@ public:
     virtual ssize_t read(uint32_t lid, vespalib::DataBuffer & buffer) const = 0;
     virtual void read(const LidVector & lids, IBufferVisitor & visitor) const = 0;
 
+    /**
+     * Hint that the data for the given lids will be read soon. Lets the
+     * implementation start all the needed disk reads at once instead of
+     * one at a time. Default is to do nothing.
+     * @param lids The local IDs that will be read.
+     **/
+    virtual void prefetch(const LidVector & lids) const { (void) lids; }
+
     /**
      * Write data to the data store.
      * @param serialNum The official unique reference number for this operation.
@@ -77,6 +77,13 @@ public:
     virtual document::Document::UP read(DocumentIdT lid, const document::DocumentTypeRepo &repo) const = 0;
     virtual void visit(const LidVector & lidVector, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const;
 
+    /**
+     * Hint that the given documents will be read soon, so the backing
+     * store can start fetching them from disk all at once.
+     * @param lids The local IDs that will be read.
+     **/
+    virtual void prefetch(const LidVector & lids) const { (void) lids; }
+
     /**
      * Serialize and store a document.
      * @param doc The document to store
@@ -9,6 +9,7 @@
 #include <vespa/vespalib/stllike/hash_map.hpp>
 #include <vespa/searchlib/common/rcuvector.hpp>
 #include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/closuretask.h>
 #include <thread>
 
 #include <vespa/log/log.h>
@@ -22,6 +23,8 @@ using vespalib::getErrorString;
 using vespalib::GenerationHandler;
 using vespalib::make_string;
 using vespalib::IllegalStateException;
+using vespalib::makeTask;
+using vespalib::makeClosure;
 using common::FileHeaderContext;
 using std::runtime_error;
 using document::BucketId;
@@ -29,6 +32,17 @@ using docstore::StoreByBucket;
 using docstore::BucketCompacter;
 using namespace std::literals;
 
+namespace {
+
+/*
+ * zstd recommends a sample set around 100 times the size of the dictionary.
+ * Documents much larger than the dictionary gain little from it and are not sampled.
+ */
+constexpr size_t DICTIONARY_SAMPLE_FACTOR = 100;
+constexpr size_t MAX_DICTIONARY_SAMPLE_FACTOR = 4;
+
+}
+
 LogDataStore::LogDataStore(vespalib::ThreadExecutor &executor,
                            const vespalib::string &dirName,
                            const Config &config,
@@ -56,7 +70,12 @@ LogDataStore::LogDataStore(vespalib::ThreadExecutor &executor,
       _tlSyncer(tlSyncer),
       _bucketizer(bucketizer),
       _currentlyCompacting(),
-      _compactLidSpaceGeneration()
+      _compactLidSpaceGeneration(),
+      _dictionary(),
+      _dictionarySamples(),
+      _dictionarySampleBytes(0),
+      _dictionaryTraining(false),
+      _newDictionary(false)
 {
     // Reserve space for 1TB summary in order to avoid locking.
     _fileChunks.reserve(LidInfo::getFileIdLimit());
@@ -102,11 +121,10 @@ LogDataStore::updateLidMap(uint32_t lastFileChunkDocIdLimit)
     }
 }
 
-void
-LogDataStore::read(const LidVector & lids, IBufferVisitor & visitor) const
+LidInfoWithLidV
+LogDataStore::getOrderedLids(const LidVector & lids) const
 {
     LidInfoWithLidV orderedLids;
-    GenerationHandler::Guard guard(_genHandler.takeGuard());
     for (uint32_t lid : lids) {
         if (lid < getDocIdLimit()) {
             LidInfo li = _lidInfo[lid];
@@ -115,9 +133,39 @@ LogDataStore::read(const LidVector & lids, IBufferVisitor & visitor) const
             }
         }
     }
+    std::sort(orderedLids.begin(), orderedLids.end());
+    return orderedLids;
+}
+
+void
+LogDataStore::prefetch(const LidInfoWithLidV & orderedLids) const
+{
+    if (orderedLids.empty() || (orderedLids.front() == orderedLids.back())) {
+        return; // Nothing to gain when reading a single chunk
+    }
+    for (size_t i(0); i < orderedLids.size(); i++) {
+        const LidInfoWithLid & li = orderedLids[i];
+        if ((i == 0) || !(orderedLids[i - 1] == li)) {
+            _fileChunks[li.getFileId()]->prefetch(li.getChunkId());
+        }
+    }
+}
+
+void
+LogDataStore::prefetch(const LidVector & lids) const
+{
+    GenerationHandler::Guard guard(_genHandler.takeGuard());
+    prefetch(getOrderedLids(lids));
+}
+
+void
+LogDataStore::read(const LidVector & lids, IBufferVisitor & visitor) const
+{
+    GenerationHandler::Guard guard(_genHandler.takeGuard());
+    LidInfoWithLidV orderedLids = getOrderedLids(lids);
     if (orderedLids.empty()) { return; }
 
-    std::sort(orderedLids.begin(), orderedLids.end());
+    prefetch(orderedLids);
     uint32_t prevFile = orderedLids[0].getFileId();
     uint32_t start = 0;
     for (size_t curr(1); curr < orderedLids.size(); curr++) {
@@ -173,6 +221,9 @@ LogDataStore::write(LockGuard guard, WriteableFileChunk & destination,
 {
     LidInfo lm = destination.append(serialNum, lid, buffer, len);
     setLid(guard, lid, lm);
+    if (useCompressionDictionary()) {
+        sampleForDictionary(guard, buffer, len);
+    }
     if (destination.getFileId() == getActiveFileId(guard)) {
         requireSpace(guard, destination);
     }
@@ -207,6 +258,58 @@ LogDataStore::requireSpace(LockGuard guard, WriteableFileChunk & active)
     }
 }
 
+bool
+LogDataStore::useCompressionDictionary() const
+{
+    return (_config.getCompressionDictionarySize() > 0) &&
+           (_config.getFileConfig().getCompression().type == CompressionConfig::ZSTD);
+}
+
+void
+LogDataStore::sampleForDictionary(const LockGuard & guard, const void * buffer, size_t len)
+{
+    assert(guard.locks(_updateLock));
+    (void) guard;
+    if (_dictionaryTraining || _newDictionary) {
+        return;
+    }
+    size_t dictionarySize = _config.getCompressionDictionarySize();
+    if ((len == 0) || (len > dictionarySize * MAX_DICTIONARY_SAMPLE_FACTOR)) {
+        return;
+    }
+    if (_dictionarySampleBytes + len > dictionarySize * DICTIONARY_SAMPLE_FACTOR) {
+        // Sample budget is full, train in the background so that the next file created gets the dictionary.
+        std::vector<std::vector<char>> samples;
+        samples.swap(_dictionarySamples);
+        _dictionarySampleBytes = 0;
+        _dictionaryTraining = true;
+        _executor.execute(makeTask(makeClosure(this, &LogDataStore::trainDictionary, std::move(samples))));
+        return;
+    }
+    const char * data = static_cast<const char *>(buffer);
+    _dictionarySamples.emplace_back(data, data + len);
+    _dictionarySampleBytes += len;
+}
+
+void
+LogDataStore::trainDictionary(std::vector<std::vector<char>> samples)
+{
+    std::vector<vespalib::ConstBufferRef> sampleRefs;
+    sampleRefs.reserve(samples.size());
+    for (const auto & sample : samples) {
+        sampleRefs.emplace_back(&sample[0], sample.size());
+    }
+    document::ZStdDictionary::SP dictionary = document::ZStdDictionary::train(sampleRefs, _config.getCompressionDictionarySize());
+    LockGuard guard(_updateLock);
+    if (dictionary) {
+        LOG(debug, "Trained compression dictionary %u of %ld bytes from %ld samples",
+                   dictionary->getId(), dictionary->getContent().size(), samples.size());
+        _dictionary = std::move(dictionary);
+        _newDictionary = true;
+    }
+    _dictionaryTraining = false;
+}
+
 uint64_t
 LogDataStore::lastSyncToken() const
 {
@@ -629,8 +732,11 @@ LogDataStore::createWritableFile(FileId fileId, SerialNum serialNum, NameId name
     FileChunk::UP file(new WriteableFileChunk(_executor, fileId, nameId, getBaseDir(),
                                               serialNum, docIdLimit,
                                               _config.getFileConfig(), _tune, _fileHeaderContext,
-                                              _bucketizer.get(), _config.crcOnReadDisabled()));
+                                              _bucketizer.get(), _config.crcOnReadDisabled(),
+                                              useCompressionDictionary() ? _dictionary : document::ZStdDictionary::SP()));
     file->enableRead();
+    // A trained dictionary has now been taken into use, start sampling for the next one.
+    _newDictionary = false;
     return file;
 }
 
@@ -763,10 +869,16 @@ LogDataStore::preload()
         typedef NameIdSet::const_iterator It;
         for (It it(partList.begin()), mt(--partList.end()); it != mt; it++) {
             _fileChunks.push_back(createReadOnlyFile(FileId(_fileChunks.size()), *it));
+            if (_fileChunks.back()->getDictionary()) {
+                _dictionary = _fileChunks.back()->getDictionary();
+            }
         }
         _fileChunks.push_back(isReadOnly()
             ? createReadOnlyFile(FileId(_fileChunks.size()), *partList.rbegin())
             : createWritableFile(FileId(_fileChunks.size()), getMinLastPersistedSerialNum(), *partList.rbegin()));
+        if (_fileChunks.back()->getDictionary()) {
+            _dictionary = _fileChunks.back()->getDictionary();
+        }
     } else {
         if ( ! isReadOnly() ) {
             _fileChunks.push_back(createWritableFile(FileId::first(), 0));
@@ -844,6 +956,7 @@ LogDataStore::eraseIncompleteCompactedFiles(NameIdSet partList)
         LOG(warning, "'%s' has been detected as an incompletely compacted file. Erasing it.", name.c_str());
         FileChunk::eraseIdxFile(name);
         FileChunk::eraseDatFile(name);
+        FileChunk::eraseDictFile(name);
     }
 
     return std::move(partList);
@@ -880,6 +993,7 @@ LogDataStore::eraseDanglingDatFiles(const NameIdSet &partList, const NameIdSet &
             vespalib::string fileName = createFileName(dbase);
             LOG(warning, "Removing dangling file '%s'", FileChunk::createDatFileName(fileName).c_str());
             FileChunk::eraseDatFile(fileName);
+            FileChunk::eraseDictFile(fileName);
             ++di;
         } else {
             ++ii;
@@ -45,6 +45,7 @@ public:
               _skipCrcOnRead(false),
               _compactToActiveFile(true),
               _compactCompression(CompressionConfig::LZ4),
+              _compressionDictionarySize(0),
               _fileConfig()
         { }
 
@@ -64,6 +65,7 @@ public:
               _skipCrcOnRead(false),
               _compactToActiveFile(compactToActiveFile),
               _compactCompression(compactCompression),
+              _compressionDictionarySize(0),
               _fileConfig(fileConfig)
         { }
 
@@ -77,6 +79,12 @@ public:
         void disableCrcOnRead(bool v) { _skipCrcOnRead = v; }
         bool compact2ActiveFile() const { return _compactToActiveFile; }
         const CompressionConfig & compactCompression() const { return _compactCompression; }
+        /**
+         * Size of the zstd dictionary trained from written documents and used when compressing chunks.
+         * Only used with zstd chunk compression, 0 disables it.
+         */
+        size_t getCompressionDictionarySize() const { return _compressionDictionarySize; }
+        void setCompressionDictionarySize(size_t v) { _compressionDictionarySize = v; }
 
         const WriteableFileChunk::Config & getFileConfig() const { return _fileConfig; }
     private:
@@ -88,6 +96,7 @@ public:
         bool                        _skipCrcOnRead;
         bool                        _compactToActiveFile;
         CompressionConfig           _compactCompression;
+        size_t                      _compressionDictionarySize;
         WriteableFileChunk::Config  _fileConfig;
     };
 public:
@@ -121,6 +130,7 @@ public:
     // Implements IDataStore API
     ssize_t read(uint32_t lid, vespalib::DataBuffer & buffer) const override;
     void read(const LidVector & lids, IBufferVisitor & visitor) const override;
+    void prefetch(const LidVector & lids) const override;
     void write(uint64_t serialNum, uint32_t lid, const void * buffer, size_t len) override;
     void remove(uint64_t serialNum, uint32_t lid) override;
     void flush(uint64_t syncToken) override;
@@ -209,6 +219,9 @@ private:
 
     void waitForUnblock();
 
+    LidInfoWithLidV getOrderedLids(const LidVector & lids) const;
+    void prefetch(const LidInfoWithLidV & orderedLids) const;
+
     // Implements ISetLid API
     void setLid(const LockGuard & guard, uint32_t lid, const LidInfo & lm) override;
 
@@ -270,6 +283,9 @@ private:
     vespalib::string createIdxFileName(NameId id) const;
 
     void requireSpace(LockGuard guard, WriteableFileChunk & active);
+    bool useCompressionDictionary() const;
+    void sampleForDictionary(const LockGuard & guard, const void * buffer, size_t len);
+    void trainDictionary(std::vector<std::vector<char>> samples);
     bool isReadOnly() const { return _readOnly; }
     void updateSerialNum();
 
@@ -323,6 +339,12 @@ private:
     IBucketizer::SP                          _bucketizer;
     NameIdSet                                _currentlyCompacting;
     uint64_t                                 _compactLidSpaceGeneration;
+    document::ZStdDictionary::SP             _dictionary;
+    std::vector<std::vector<char>>           _dictionarySamples;
+    size_t                                   _dictionarySampleBytes;
+    bool                                     _dictionaryTraining;
+    // Set when a trained dictionary has not yet been used by a new file, no sampling is done until then.
+    bool                                     _newDictionary;
 };
 
 } // namespace search
@@ -18,6 +18,12 @@ public:
     typedef std::shared_ptr<FastOS_FileInterface> FSP;
     virtual ~FileRandRead() { }
     virtual FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) = 0;
+    /**
+     * Hint that the given range will be read soon. Lets the kernel start
+     * reading it in the background, so that reads of many ranges can be
+     * in flight at the same time. Default is to do nothing.
+     */
+    virtual void prefetch(size_t offset, size_t sz) { (void) offset; (void) sz; }
     virtual int64_t getSize() = 0;
 };
 
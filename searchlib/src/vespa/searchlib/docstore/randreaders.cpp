@@ -4,12 +4,28 @@
 #include "summaryexceptions.h"
 #include <vespa/vespalib/data/databuffer.h>
 #include <vespa/fastos/file.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".search.docstore.randreaders");
 
 namespace search {
 
+namespace {
+
+void
+adviseWillNeed(const void *data, size_t sz)
+{
+    static const size_t pageSize = sysconf(_SC_PAGESIZE);
+    size_t start = reinterpret_cast<size_t>(data) & ~(pageSize - 1);
+    size_t end = reinterpret_cast<size_t>(data) + sz;
+    madvise(reinterpret_cast<void *>(start), end - start, MADV_WILLNEED);
+}
+
+}
+
 DirectIORandRead::DirectIORandRead(const vespalib::string & fileName)
     : _file(std::make_unique<FastOS_File>(fileName.c_str())),
       _alignment(1),
@@ -84,6 +100,15 @@ MMapRandRead::read(size_t offset, vespalib::DataBuffer & buffer, size_t sz)
     return FSP();
 }
 
+void
+MMapRandRead::prefetch(size_t offset, size_t sz)
+{
+    const void *data = _file->MemoryMapPtr(offset);
+    if ((data != nullptr) && (sz > 0) && (_file->MemoryMapPtr(offset + sz - 1) != nullptr)) {
+        adviseWillNeed(data, sz);
+    }
+}
+
 int64_t
 MMapRandRead::getSize() {
     return _file->GetSize();
@@ -140,6 +165,16 @@ MMapRandReadDynamic::read(size_t offset, vespalib::DataBuffer & buffer, size_t s
     return file;
 }
 
+void
+MMapRandReadDynamic::prefetch(size_t offset, size_t sz)
+{
+    FSP file(_holder.get());
+    const void *data = file->MemoryMapPtr(offset);
+    if ((data != nullptr) && contains(*file, offset + sz)) {
+        adviseWillNeed(data, sz);
+    }
+}
+
 bool
 MMapRandReadDynamic::contains(const FastOS_FileInterface & file, size_t sz) {
     return (sz == 0) || (file.MemoryMapPtr(sz - 1) != nullptr);
@@ -161,6 +196,12 @@ NormalRandRead::read(size_t offset, vespalib::DataBuffer & buffer, size_t sz)
     return FSP();
 }
 
+void
+NormalRandRead::prefetch(size_t offset, size_t sz)
+{
+    posix_fadvise(static_cast<FastOS_File &>(*_file).getFileDescriptor(), offset, sz, POSIX_FADV_WILLNEED);
+}
+
 int64_t
 NormalRandRead::getSize()
 {
@@ -85,7 +85,8 @@ WriteableFileChunk(vespalib::ThreadExecutor &executor,
                    const TuneFileSummary &tune,
                    const FileHeaderContext &fileHeaderContext,
                    const IBucketizer * bucketizer,
-                   bool skipCrcOnRead)
+                   bool skipCrcOnRead,
+                   document::ZStdDictionary::SP dictionary)
     : FileChunk(fileId, nameId, baseName, tune, bucketizer, skipCrcOnRead),
       _config(config),
       _serialNum(initialSerialNum),
@@ -139,10 +140,36 @@ WriteableFileChunk(vespalib::ThreadExecutor &executor,
     } else {
         throw SummaryException("Failed opening data file", _dataFile, VESPA_STRLOC);
     }
+    if ( ! _dictionary && dictionary && (config.getCompression().type == document::CompressionConfig::ZSTD)) {
+        writeDictionary(std::move(dictionary));
+    }
     _firstChunkIdToBeWritten = _active->getId();
     updateCurrentDiskFootprint();
 }
 
+void
+WriteableFileChunk::writeDictionary(document::ZStdDictionary::SP dictionary)
+{
+    vespalib::string fileName(createDictFileName(getName()));
+    vespalib::string tmpFileName(fileName + ".tmp");
+    vespalib::ConstBufferRef content(dictionary->getContent());
+    FastOS_File file(tmpFileName.c_str());
+    if ( ! file.OpenWriteOnlyTruncate()) {
+        throw SummaryException("Failed opening dict file", file, VESPA_STRLOC);
+    }
+    file.WriteBuf(content.c_str(), content.size());
+    if ( ! file.Sync()) {
+        throw SummaryException("Failed syncing dict file", file, VESPA_STRLOC);
+    }
+    if ( ! file.Close()) {
+        throw SummaryException("Failed closing dict file", file, VESPA_STRLOC);
+    }
+    if ( ! FastOS_File::Rename(tmpFileName.c_str(), fileName.c_str())) {
+        throw SummaryException("Failed renaming dict file", file, VESPA_STRLOC);
+    }
+    _dictionary = std::move(dictionary);
+}
+
 std::unique_ptr<FastOS_FileInterface>
 WriteableFileChunk::openIdx() {
     auto file = std::make_unique<FastOS_File>(_idxFileName.c_str());
@@ -242,6 +269,24 @@ WriteableFileChunk::read(LidInfoWithLidV::const_iterator begin, size_t count, IB
     }
 }
 
+void
+WriteableFileChunk::prefetch(SubChunkId chunkId) const
+{
+    if (!frozen()) {
+        ChunkInfo chunkInfo;
+        {
+            LockGuard guard(_lock);
+            if ((chunkId >= _chunkInfo.size()) || !_chunkInfo[chunkId].valid()) {
+                return; // Chunk is still in memory
+            }
+            chunkInfo = _chunkInfo[chunkId];
+        }
+        prefetchChunk(chunkInfo);
+    } else {
+        FileChunk::prefetch(chunkId);
+    }
+}
+
 ssize_t
 WriteableFileChunk::read(uint32_t lid, SubChunkId chunkId, vespalib::DataBuffer & buffer) const
 {
@@ -277,7 +322,7 @@ WriteableFileChunk::internalFlush(uint32_t chunkId, uint64_t serialNum)
     if (_alignment > 1) {
         tmp->getBuf().ensureFree(active->getMaxPackSize(_config.getCompression()) + _alignment - 1);
     }
-    active->pack(serialNum, tmp->getBuf(), _config.getCompression());
+    active->pack(serialNum, tmp->getBuf(), _config.getCompression(), _dictionary.get());
     tmp->setPayLoad();
     if (_alignment > 1) {
         const size_t padAfter((_alignment - tmp->getPayLoad() % _alignment) % _alignment);
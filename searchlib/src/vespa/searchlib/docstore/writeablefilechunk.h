@@ -50,11 +50,13 @@ public:
                        const TuneFileSummary &tune,
                        const common::FileHeaderContext &fileHeaderContext,
                        const IBucketizer * bucketizer,
-                       bool crcOnReadDisabled);
+                       bool crcOnReadDisabled,
+                       document::ZStdDictionary::SP dictionary = document::ZStdDictionary::SP());
     ~WriteableFileChunk();
 
     ssize_t read(uint32_t lid, SubChunkId chunk, vespalib::DataBuffer & buffer) const override;
     void read(LidInfoWithLidV::const_iterator begin, size_t count, IBufferVisitor & visitor) const override;
+    void prefetch(SubChunkId chunk) const override;
 
     LidInfo append(uint64_t serialNum, uint32_t lid, const void * buffer, size_t len);
     void flush(bool block, uint64_t syncToken);
@@ -92,6 +94,7 @@ private:
     void readDataHeader();
     void readIdxHeader(FastOS_FileInterface & idxFile);
     void writeDataHeader(const common::FileHeaderContext &fileHeaderContext);
+    void writeDictionary(document::ZStdDictionary::SP dictionary);
     bool needFlushPendingChunks(uint64_t serialNum, uint64_t datFileLen);
     bool needFlushPendingChunks(const vespalib::MonitorGuard & guard, uint64_t serialNum, uint64_t datFileLen);
     fastos::TimeStamp unconditionallyFlushPendingChunks(const vespalib::LockGuard & flushGuard, uint64_t serialNum, uint64_t datFileLen);
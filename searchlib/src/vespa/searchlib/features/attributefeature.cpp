@@ -32,6 +32,8 @@ using search::fef::FeatureExecutor;
 using search::features::util::ConstCharPtr;
 using vespalib::eval::ValueType;
 using search::fef::FeatureType;
+using search::feature_t;
+using vespalib::ConstArrayRef;
 
 using namespace search::fef::indexproperties;
 
@@ -114,6 +116,9 @@ public:
      */
     SingleAttributeExecutor(const T & attribute) : _attribute(attribute) { }
     void execute(uint32_t docId) override;
+    bool supports_batch() const override { return true; }
+    void handle_execute_batch(ConstArrayRef<uint32_t> docids, ConstArrayRef<const feature_t *> inputs,
+                              ConstArrayRef<feature_t *> outputs) override;
 };
 
 class CountOnlyAttributeExecutor : public fef::FeatureExecutor {
@@ -128,6 +133,9 @@ public:
      */
     CountOnlyAttributeExecutor(const attribute::IAttributeVector & attribute) : _attribute(attribute) { }
     void execute(uint32_t docId) override;
+    bool supports_batch() const override { return true; }
+    void handle_execute_batch(ConstArrayRef<uint32_t> docids, ConstArrayRef<const feature_t *> inputs,
+                              ConstArrayRef<feature_t *> outputs) override;
 };
 /**
  * Implements the executor for fetching values from a single or array attribute vector
@@ -150,6 +158,11 @@ public:
      */
     AttributeExecutor(const search::attribute::IAttributeVector * attribute, uint32_t idx);
     void execute(uint32_t docId) override;
+    bool supports_batch() const override { return true; }
+    void handle_execute_batch(ConstArrayRef<uint32_t> docids, ConstArrayRef<const feature_t *>,
+                              ConstArrayRef<feature_t *> outputs) override {
+        execute_batch_by_document(docids, outputs);
+    }
 };
 
 
@@ -175,6 +188,11 @@ public:
      */
     WeightedSetAttributeExecutor(const search::attribute::IAttributeVector * attribute, T key, bool useKey);
     void execute(uint32_t docId) override;
+    bool supports_batch() const override { return true; }
+    void handle_execute_batch(ConstArrayRef<uint32_t> docids, ConstArrayRef<const feature_t *>,
+                              ConstArrayRef<feature_t *> outputs) override {
+        execute_batch_by_document(docids, outputs);
+    }
 };
 
 template <typename T>
@@ -191,6 +209,23 @@ SingleAttributeExecutor<T>::execute(uint32_t docId)
     outputs().set_number(3, 1.0f);  // count
 }
 
+template <typename T>
+void
+SingleAttributeExecutor<T>::handle_execute_batch(ConstArrayRef<uint32_t> docids, ConstArrayRef<const feature_t *>,
+                                                 ConstArrayRef<feature_t *> out)
+{
+    feature_t *value = out[0];
+    for (size_t i = 0; i < docids.size(); ++i) {
+        typename T::LoadedValueType v = _attribute.getFast(docids[i]);
+        value[i] = __builtin_expect(attribute::isUndefined(v), false)
+                   ? attribute::getUndefined<search::feature_t>()
+                   : util::getAsFeature(v);
+    }
+    std::fill_n(out[1], docids.size(), 0.0f); // weight
+    std::fill_n(out[2], docids.size(), 0.0f); // contains
+    std::fill_n(out[3], docids.size(), 1.0f); // count
+}
+
 void
 CountOnlyAttributeExecutor::execute(uint32_t docId)
 {
@@ -200,6 +235,19 @@ CountOnlyAttributeExecutor::execute(uint32_t docId)
     outputs().set_number(3, _attribute.getValueCount(docId)); // count
 }
 
+void
+CountOnlyAttributeExecutor::handle_execute_batch(ConstArrayRef<uint32_t> docids, ConstArrayRef<const feature_t *>,
+                                                 ConstArrayRef<feature_t *> out)
+{
+    std::fill_n(out[0], docids.size(), 0.0f); // value
+    std::fill_n(out[1], docids.size(), 0.0f); // weight
+    std::fill_n(out[2], docids.size(), 0.0f); // contains
+    feature_t *count = out[3];
+    for (size_t i = 0; i < docids.size(); ++i) {
+        count[i] = _attribute.getValueCount(docids[i]);
+    }
+}
+
 template <typename T>
 AttributeExecutor<T>::AttributeExecutor(const IAttributeVector * attribute, uint32_t idx) :
     fef::FeatureExecutor(),
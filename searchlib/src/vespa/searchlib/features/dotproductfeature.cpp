@@ -18,6 +18,7 @@ LOG_SETUP(".features.dotproduct");
 using namespace search::attribute;
 using namespace search::fef;
 using vespalib::hwaccelrated::IAccelrated;
+using vespalib::ConstArrayRef;
 
 namespace search {
 namespace features {
@@ -87,6 +88,20 @@ void DotProductExecutorBase<BaseType>::execute(uint32_t docId) {
             &_queryVector[0], reinterpret_cast<const typename AT::ValueType *>(values), commonRange));
 }
 
+template <typename BaseType>
+void DotProductExecutorBase<BaseType>::handle_execute_batch(ConstArrayRef<uint32_t> docids,
+                                                            ConstArrayRef<const feature_t *>,
+                                                            ConstArrayRef<feature_t *> out)
+{
+    feature_t *result = out[0];
+    for (size_t i = 0; i < docids.size(); ++i) {
+        const AT *values(nullptr);
+        size_t count = getAttributeValues(docids[i], values);
+        size_t commonRange = std::min(count, _queryVector.size());
+        result[i] = _multiplier->dotProduct(&_queryVector[0], reinterpret_cast<const typename AT::ValueType *>(values), commonRange);
+    }
+}
+
 template <typename A>
 DotProductExecutor<A>::DotProductExecutor(const A * attribute, const V & queryVector) :
     DotProductExecutorBase<typename A::BaseType>(queryVector),
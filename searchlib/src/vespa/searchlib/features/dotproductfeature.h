@@ -120,6 +120,11 @@ private:
 public:
     DotProductExecutor(const search::attribute::IAttributeVector * attribute, const Vector & queryVector);
     void execute(uint32_t docId) override;
+    bool supports_batch() const override { return true; }
+    void handle_execute_batch(vespalib::ConstArrayRef<uint32_t> docids, vespalib::ConstArrayRef<const feature_t *>,
+                              vespalib::ConstArrayRef<feature_t *> outputs) override {
+        execute_batch_by_document(docids, outputs);
+    }
 };
 
 }
@@ -144,6 +149,9 @@ public:
     DotProductExecutorBase(const V & queryVector);
     ~DotProductExecutorBase();
     void execute(uint32_t docId) final override;
+    bool supports_batch() const override { return true; }
+    void handle_execute_batch(vespalib::ConstArrayRef<uint32_t> docids, vespalib::ConstArrayRef<const feature_t *> inputs,
+                              vespalib::ConstArrayRef<feature_t *> outputs) final override;
 };
 
 /**
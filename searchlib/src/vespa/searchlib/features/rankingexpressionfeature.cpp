@@ -24,6 +24,7 @@ using vespalib::tensor::DefaultTensorEngine;
 using search::fef::FeatureType;
 using vespalib::ArrayRef;
 using vespalib::ConstArrayRef;
+using search::feature_t;
 
 namespace search {
 namespace features {
@@ -49,6 +50,7 @@ class CompiledRankingExpressionExecutor : public fef::FeatureExecutor
 {
 private:
     typedef double (*arr_function)(const double *);
+    const CompiledFunction &_compiled_function;
     arr_function _ranking_function;
     std::vector<double> _params;
 
@@ -56,6 +58,9 @@ public:
     CompiledRankingExpressionExecutor(const CompiledFunction &compiled_function);
     bool isPure() override { return true; }
     void execute(uint32_t docId) override;
+    bool supports_batch() const override { return true; }
+    void handle_execute_batch(ConstArrayRef<uint32_t> docids, ConstArrayRef<const feature_t *> inputs,
+                              ConstArrayRef<feature_t *> outputs) override;
 };
 
 //-----------------------------------------------------------------------------
@@ -73,6 +78,9 @@ public:
     LazyCompiledRankingExpressionExecutor(const CompiledFunction &compiled_function);
     bool isPure() override { return true; }
     void execute(uint32_t docId) override;
+    bool supports_batch() const override { return true; }
+    void handle_execute_batch(ConstArrayRef<uint32_t> docids, ConstArrayRef<const feature_t *> inputs,
+                              ConstArrayRef<feature_t *> outputs) override;
 };
 
 //-----------------------------------------------------------------------------
@@ -111,7 +119,8 @@ public:
 //-----------------------------------------------------------------------------
 
 CompiledRankingExpressionExecutor::CompiledRankingExpressionExecutor(const CompiledFunction &compiled_function)
-    : _ranking_function(compiled_function.get_function()),
+    : _compiled_function(compiled_function),
+      _ranking_function(compiled_function.get_function()),
       _params(compiled_function.num_params(), 0.0)
 {
 }
@@ -132,6 +141,14 @@ CompiledRankingExpressionExecutor::execute(uint32_t)
     outputs().set_number(0, _ranking_function(&_params[0]));
 }
 
+void
+CompiledRankingExpressionExecutor::handle_execute_batch(ConstArrayRef<uint32_t> docids,
+                                                        ConstArrayRef<const feature_t *> in,
+                                                        ConstArrayRef<feature_t *> out)
+{
+    _compiled_function.eval_batch(in.begin(), docids.size(), out[0]);
+}
+
 //-----------------------------------------------------------------------------
 
 using Context = fef::FeatureExecutor::Inputs;
@@ -149,6 +166,28 @@ LazyCompiledRankingExpressionExecutor::execute(uint32_t)
     outputs().set_number(0, _ranking_function(resolve_input, make_ctx(inputs())));
 }
 
+struct BatchContext {
+    ConstArrayRef<const feature_t *> inputs;
+    size_t doc;
+    BatchContext(ConstArrayRef<const feature_t *> inputs_in) : inputs(inputs_in), doc(0) {}
+};
+double resolve_batch_input(void *ctx, size_t idx) {
+    const BatchContext &batch = *((const BatchContext *)(ctx));
+    return batch.inputs[idx][batch.doc];
+}
+
+void
+LazyCompiledRankingExpressionExecutor::handle_execute_batch(ConstArrayRef<uint32_t> docids,
+                                                            ConstArrayRef<const feature_t *> in,
+                                                            ConstArrayRef<feature_t *> out)
+{
+    feature_t *result = out[0];
+    BatchContext ctx(in);
+    for (; ctx.doc < docids.size(); ++ctx.doc) {
+        result[ctx.doc] = _ranking_function(resolve_batch_input, &ctx);
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 InterpretedRankingExpressionExecutor::InterpretedRankingExpressionExecutor(const InterpretedFunction &function,
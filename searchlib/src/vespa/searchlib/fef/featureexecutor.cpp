@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "featureexecutor.h"
+#include <cstdlib>
 
 namespace search {
 namespace fef {
@@ -17,6 +18,32 @@ FeatureExecutor::isPure()
     return false;
 }
 
+bool
+FeatureExecutor::supports_batch() const
+{
+    return false;
+}
+
+void
+FeatureExecutor::handle_execute_batch(vespalib::ConstArrayRef<uint32_t>,
+                                      vespalib::ConstArrayRef<const feature_t *>,
+                                      vespalib::ConstArrayRef<feature_t *>)
+{
+    abort(); // only called for executors supporting batch execution
+}
+
+void
+FeatureExecutor::execute_batch_by_document(vespalib::ConstArrayRef<uint32_t> docids,
+                                           vespalib::ConstArrayRef<feature_t *> outputs)
+{
+    for (size_t i = 0; i < docids.size(); ++i) {
+        execute(docids[i]);
+        for (size_t out_idx = 0; out_idx < outputs.size(); ++out_idx) {
+            outputs[out_idx][i] = _outputs.get_number(out_idx);
+        }
+    }
+}
+
 void
 FeatureExecutor::handle_bind_inputs(vespalib::ConstArrayRef<LazyValue>)
 {
@@ -107,6 +107,29 @@ protected:
      **/
     virtual void execute(uint32_t docId) = 0;
 
+    /**
+     * Execute this feature executor for a batch of documents. Input
+     * and output values are stored in columns with one value per
+     * document. This function is only called for executors claiming
+     * to support batch execution; the default implementation aborts.
+     *
+     * @param docids the local document ids being evaluated
+     * @param inputs one column of input values per input
+     * @param outputs one column of output values per output
+     **/
+    virtual void handle_execute_batch(vespalib::ConstArrayRef<uint32_t> docids,
+                                      vespalib::ConstArrayRef<const feature_t *> inputs,
+                                      vespalib::ConstArrayRef<feature_t *> outputs);
+
+    /**
+     * Batch execution helper for executors without inputs that do
+     * not use match data. It runs the normal execute function for
+     * each document and copies the output values into the output
+     * columns.
+     **/
+    void execute_batch_by_document(vespalib::ConstArrayRef<uint32_t> docids,
+                                   vespalib::ConstArrayRef<feature_t *> outputs);
+
 public:
     /**
      * Create a feature executor that has not yet been bound to neither
@@ -140,6 +163,32 @@ public:
      **/
     virtual bool isPure();
 
+    /**
+     * Check if this feature executor supports batch execution. An
+     * executor claiming to support batch execution must implement
+     * handle_execute_batch, all its inputs and outputs must be
+     * numbers, and it must not use match data, since the match data
+     * only contains information about a single document. Executors
+     * supporting batch execution may be used to calculate ranking
+     * for a block of documents at a time.
+     *
+     * @return true if this feature executor supports batch execution
+     **/
+    virtual bool supports_batch() const;
+
+    /**
+     * Execute this feature executor for a batch of documents. See
+     * handle_execute_batch for details.
+     **/
+    void execute_batch(vespalib::ConstArrayRef<uint32_t> docids,
+                       vespalib::ConstArrayRef<const feature_t *> inputs,
+                       vespalib::ConstArrayRef<feature_t *> outputs)
+    {
+        handle_execute_batch(docids, inputs, outputs);
+        // the single document outputs no longer match the last docid
+        _inputs.set_docid(-1);
+    }
+
     /**
      * Make sure this executor has been executed for the given
      * document.
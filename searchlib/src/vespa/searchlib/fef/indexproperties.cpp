@@ -189,6 +189,36 @@ NumSearchPartitions::lookup(const Properties &props, uint32_t defaultValue)
     return lookupUint32(props, NAME, defaultValue);
 }
 
+const vespalib::string WorkStealingChunksPerThread::NAME("vespa.matching.workstealing.chunksperthread");
+const uint32_t WorkStealingChunksPerThread::DEFAULT_VALUE(0);
+
+uint32_t
+WorkStealingChunksPerThread::lookup(const Properties &props)
+{
+    return lookup(props, DEFAULT_VALUE);
+}
+
+uint32_t
+WorkStealingChunksPerThread::lookup(const Properties &props, uint32_t defaultValue)
+{
+    return lookupUint32(props, NAME, defaultValue);
+}
+
+const vespalib::string WorkStealingNumNodes::NAME("vespa.matching.workstealing.numnodes");
+const uint32_t WorkStealingNumNodes::DEFAULT_VALUE(1);
+
+uint32_t
+WorkStealingNumNodes::lookup(const Properties &props)
+{
+    return lookup(props, DEFAULT_VALUE);
+}
+
+uint32_t
+WorkStealingNumNodes::lookup(const Properties &props, uint32_t defaultValue)
+{
+    return lookupUint32(props, NAME, defaultValue);
+}
+
 const vespalib::string MinHitsPerThread::NAME("vespa.matching.minhitsperthread");
 const uint32_t MinHitsPerThread::DEFAULT_VALUE(0);
 
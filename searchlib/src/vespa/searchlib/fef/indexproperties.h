@@ -133,6 +133,28 @@ namespace matching {
         static uint32_t lookup(const Properties &props);
         static uint32_t lookup(const Properties &props, uint32_t defaultValue);
     };
+    /**
+     * Property for the number of docid chunks initially given to each
+     * search thread by the work-stealing scheduler. A value of 0 (the
+     * default) disables work stealing.
+     **/
+    struct WorkStealingChunksPerThread {
+        static const vespalib::string NAME;
+        static const uint32_t DEFAULT_VALUE;
+        static uint32_t lookup(const Properties &props);
+        static uint32_t lookup(const Properties &props, uint32_t defaultValue);
+    };
+    /**
+     * Property for the number of nodes (e.g. NUMA nodes) the search
+     * threads are grouped into when work stealing. Threads steal
+     * from threads in their own node first.
+     **/
+    struct WorkStealingNumNodes {
+        static const vespalib::string NAME;
+        static const uint32_t DEFAULT_VALUE;
+        static uint32_t lookup(const Properties &props);
+        static uint32_t lookup(const Properties &props, uint32_t defaultValue);
+    };
 }
 
 namespace softtimeout {
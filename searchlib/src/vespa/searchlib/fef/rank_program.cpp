@@ -157,7 +157,10 @@ RankProgram::RankProgram(BlueprintResolver::SP resolver)
       _cold_stash(),
       _executors(),
       _unboxed_seeds(),
-      _is_const()
+      _is_const(),
+      _batch_steps(),
+      _batch_columns(),
+      _batch_seed(0)
 {
 }
 
@@ -218,6 +221,92 @@ RankProgram::setup(const MatchDataLayout &mdl_in,
     assert(_executors.size() == specs.size());
 }
 
+bool
+RankProgram::prepare_batch()
+{
+    const auto &specs = _resolver->getExecutorSpecs();
+    const auto &seeds = _resolver->getSeedMap();
+    if (_executors.empty() || (seeds.size() != 1)) {
+        return false;
+    }
+    BlueprintResolver::FeatureRef seed = seeds.begin()->second;
+    if (specs[seed.executor].output_types[seed.output]) {
+        return false;
+    }
+    // find all non-constant executors needed to calculate the seed
+    std::vector<bool> needed(_executors.size(), false);
+    needed[seed.executor] = !check_const(_executors[seed.executor]->outputs().get_raw(seed.output));
+    for (size_t i = _executors.size(); i-- > 0; ) {
+        if (!needed[i]) {
+            continue;
+        }
+        if (!_executors[i]->supports_batch()) {
+            return false;
+        }
+        for (bool is_object: specs[i].output_types) {
+            if (is_object) {
+                return false;
+            }
+        }
+        for (const auto &ref: specs[i].inputs) {
+            if (!check_const(_executors[ref.executor]->outputs().get_raw(ref.output))) {
+                needed[ref.executor] = true;
+            } else if (specs[ref.executor].output_types[ref.output]) {
+                return false;
+            }
+        }
+    }
+    // assign columns; constant values get a column filled with the value
+    std::map<const NumberOrObject *, size_t> columns;
+    std::vector<feature_t> constants;
+    auto column_of = [&](const NumberOrObject *value) {
+        auto pos = columns.find(value);
+        if (pos == columns.end()) {
+            pos = columns.emplace(value, columns.size()).first;
+            constants.push_back(check_const(value) ? value->as_number : 0.0);
+        }
+        return pos->second;
+    };
+    _batch_steps.clear();
+    for (size_t i = 0; i < _executors.size(); ++i) {
+        if (!needed[i]) {
+            continue;
+        }
+        BatchStep step(_executors[i]);
+        for (const auto &ref: specs[i].inputs) {
+            step.inputs.push_back(column_of(_executors[ref.executor]->outputs().get_raw(ref.output)));
+        }
+        for (size_t out_idx = 0; out_idx < _executors[i]->outputs().size(); ++out_idx) {
+            step.outputs.push_back(column_of(_executors[i]->outputs().get_raw(out_idx)));
+        }
+        _batch_steps.push_back(std::move(step));
+    }
+    _batch_seed = column_of(_executors[seed.executor]->outputs().get_raw(seed.output));
+    _batch_columns.assign(constants.size() * BATCH_SIZE, 0.0);
+    for (size_t col = 0; col < constants.size(); ++col) {
+        std::fill_n(&_batch_columns[col * BATCH_SIZE], BATCH_SIZE, constants[col]);
+    }
+    for (BatchStep &step: _batch_steps) {
+        for (size_t col: step.inputs) {
+            step.input_ptrs.push_back(&_batch_columns[col * BATCH_SIZE]);
+        }
+        for (size_t col: step.outputs) {
+            step.output_ptrs.push_back(&_batch_columns[col * BATCH_SIZE]);
+        }
+    }
+    return true;
+}
+
+vespalib::ConstArrayRef<feature_t>
+RankProgram::execute_batch(vespalib::ConstArrayRef<uint32_t> docids)
+{
+    assert(docids.size() <= BATCH_SIZE);
+    for (BatchStep &step: _batch_steps) {
+        step.executor->execute_batch(docids, step.input_ptrs, step.output_ptrs);
+    }
+    return vespalib::ConstArrayRef<feature_t>(&_batch_columns[_batch_seed * BATCH_SIZE], docids.size());
+}
+
 FeatureResolver
 RankProgram::get_seeds(bool unbox_seeds) const
 {
@@ -36,6 +36,16 @@ private:
     using MappedValues = std::map<const NumberOrObject *, LazyValue>;
     using ValueSet = std::set<const NumberOrObject *>;
 
+    // executor with value columns used for batch execution
+    struct BatchStep {
+        FeatureExecutor         *executor;
+        std::vector<size_t>      inputs;
+        std::vector<size_t>      outputs;
+        std::vector<const feature_t *> input_ptrs;
+        std::vector<feature_t *> output_ptrs;
+        BatchStep(FeatureExecutor *executor_in) : executor(executor_in), inputs(), outputs(), input_ptrs(), output_ptrs() {}
+    };
+
     BlueprintResolver::SP            _resolver;
     MatchData::UP                    _match_data;
     vespalib::Stash                  _hot_stash;
@@ -43,6 +53,9 @@ private:
     std::vector<FeatureExecutor *>   _executors;
     MappedValues                     _unboxed_seeds;
     ValueSet                         _is_const;
+    std::vector<BatchStep>           _batch_steps;
+    std::vector<feature_t>           _batch_columns;
+    size_t                           _batch_seed;
 
     bool check_const(const NumberOrObject *value) const { return (_is_const.count(value) == 1); }
     bool check_const(FeatureExecutor *executor, const std::vector<BlueprintResolver::FeatureRef> &inputs) const;
@@ -53,6 +66,11 @@ private:
 public:
     typedef std::unique_ptr<RankProgram> UP;
 
+    /**
+     * The maximum number of documents in a single batch.
+     **/
+    static constexpr size_t BATCH_SIZE = 128;
+
     /**
      * Create a new rank program backed by the given resolver.
      *
@@ -98,6 +116,29 @@ public:
      * @params unbox_seeds make sure seeds values are numbers
      **/
     FeatureResolver get_all_features(bool unbox_seeds = true) const;
+
+    /**
+     * Prepare for calculating the single seed feature of this rank
+     * program for a batch of documents at a time. This is only
+     * possible if the seed is a number and all non-constant
+     * executors it depends on support batch execution. Such
+     * executors do not use match data, but iterators must still be
+     * unpacked for each hit, since unpacking may also drive the
+     * search itself (e.g. the score threshold of parallel wand).
+     *
+     * @return whether batch execution is possible
+     **/
+    bool prepare_batch();
+
+    /**
+     * Calculate the seed feature for a batch of at most BATCH_SIZE
+     * documents. The returned values are valid until the next call
+     * to this function. Batch execution must have been prepared.
+     *
+     * @return seed feature values, one per document
+     * @param docids the local document ids to calculate the seed for
+     **/
+    vespalib::ConstArrayRef<feature_t> execute_batch(vespalib::ConstArrayRef<uint32_t> docids);
 };
 
 } // namespace fef
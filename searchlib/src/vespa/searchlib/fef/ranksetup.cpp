@@ -38,6 +38,8 @@ RankSetup::RankSetup(const BlueprintFactory &factory, const IIndexEnvironment &i
       _numThreads(0),
       _minHitsPerThread(0),
       _numSearchPartitions(0),
+      _workStealingChunksPerThread(0),
+      _workStealingNumNodes(1),
       _heapSize(0),
       _arraySize(0),
       _estimatePoint(0),
@@ -81,6 +83,8 @@ RankSetup::configure()
     setNumThreadsPerSearch(matching::NumThreadsPerSearch::lookup(_indexEnv.getProperties()));
     setMinHitsPerThread(matching::MinHitsPerThread::lookup(_indexEnv.getProperties()));
     setNumSearchPartitions(matching::NumSearchPartitions::lookup(_indexEnv.getProperties()));
+    setWorkStealingChunksPerThread(matching::WorkStealingChunksPerThread::lookup(_indexEnv.getProperties()));
+    setWorkStealingNumNodes(matching::WorkStealingNumNodes::lookup(_indexEnv.getProperties()));
     setHeapSize(hitcollector::HeapSize::lookup(_indexEnv.getProperties()));
     setArraySize(hitcollector::ArraySize::lookup(_indexEnv.getProperties()));
     setDegradationAttribute(matchphase::DegradationAttribute::lookup(_indexEnv.getProperties()));
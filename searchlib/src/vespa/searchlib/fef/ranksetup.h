@@ -36,6 +36,8 @@ private:
     uint32_t                 _numThreads;
     uint32_t                 _minHitsPerThread;
     uint32_t                 _numSearchPartitions;
+    uint32_t                 _workStealingChunksPerThread;
+    uint32_t                 _workStealingNumNodes;
     uint32_t                 _heapSize;
     uint32_t                 _arraySize;
     uint32_t                 _estimatePoint;
@@ -158,6 +160,11 @@ public:
 
     uint32_t getNumSearchPartitions() const { return _numSearchPartitions; }
 
+    void setWorkStealingChunksPerThread(uint32_t chunksPerThread) { _workStealingChunksPerThread = chunksPerThread; }
+    uint32_t getWorkStealingChunksPerThread() const { return _workStealingChunksPerThread; }
+    void setWorkStealingNumNodes(uint32_t numNodes) { _workStealingNumNodes = numNodes; }
+    uint32_t getWorkStealingNumNodes() const { return _workStealingNumNodes; }
+
     /**
      * Sets the heap size to be used in the hit collector.
      *
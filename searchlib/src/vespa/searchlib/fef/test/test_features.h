@@ -23,7 +23,7 @@ struct ImpureValueBlueprint : Blueprint {
 
 //-----------------------------------------------------------------------------
 
-// "docid" calculates local document id
+// "docid" calculates local document id (supports batch execution)
 struct DocidBlueprint : Blueprint {
     DocidBlueprint() : Blueprint("docid") {}
     void visitDumpFeatures(const IIndexEnvironment &, IDumpFeatureVisitor &) const override {}
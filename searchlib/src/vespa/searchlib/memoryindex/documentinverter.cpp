@@ -14,6 +14,7 @@
 #include <vespa/searchlib/common/sort.h>
 #include <vespa/document/repo/fixedtyperepo.h>
 #include <vespa/searchlib/common/isequencedtaskexecutor.h>
+#include <vespa/vespalib/util/sync.h>
 #include <vespa/log/log.h>
 
 LOG_SETUP(".memoryindex.documentinverter");
@@ -47,13 +48,16 @@ using search::util::URL;
 
 DocumentInverter::DocumentInverter(const Schema &schema,
                                    ISequencedTaskExecutor &invertThreads,
-                                   ISequencedTaskExecutor &pushThreads)
+                                   ISequencedTaskExecutor &pushThreads,
+                                   uint32_t numFieldPartitions)
     : _schema(schema),
       _indexedFieldPaths(),
       _dataType(nullptr),
       _schemaIndexFields(),
       _inverters(),
       _urlInverters(),
+      _partitionInverters(),
+      _fieldPartitions(),
       _invertThreads(invertThreads),
       _pushThreads(pushThreads)
 {
@@ -63,6 +67,18 @@ DocumentInverter::DocumentInverter(const Schema &schema,
          ++fieldId) {
         _inverters.push_back(std::make_unique<FieldInverter>(_schema, fieldId));
     }
+    _fieldPartitions.resize(_schema.getNumIndexFields());
+    for (uint32_t fieldId : _schemaIndexFields._textFields) {
+        FieldPartitions &partitions = _fieldPartitions[fieldId];
+        partitions.emplace_back(_inverters[fieldId].get(),
+                                _invertThreads.getExecutorId(fieldId));
+        for (uint32_t partId = 1; partId < numFieldPartitions; ++partId) {
+            _partitionInverters.push_back(std::make_unique<FieldInverter>(_schema, fieldId));
+            uint64_t componentId = (static_cast<uint64_t>(partId) << 32) | fieldId;
+            partitions.emplace_back(_partitionInverters.back().get(),
+                                    _invertThreads.getExecutorId(componentId));
+        }
+    }
     for (auto &urlField : _schemaIndexFields._uriFields) {
         Schema::CollectionType collectionType =
             _schema.getIndexField(urlField._all).getCollectionType();
@@ -137,10 +153,11 @@ DocumentInverter::invertDocument(uint32_t docId, const Document &doc)
             // FieldValue::UP fv = doc.getNestedFieldValue(fieldPath.begin(), fieldPath.end());
             fv = doc.getValue(*fieldPath);
         }
-        FieldInverter *inverter = _inverters[fieldId].get();
-        _invertThreads.execute(fieldId,
-                               [inverter, docId, fv(std::move(fv))]()
-                               { inverter->invertField(docId, fv); });
+        const FieldPartition &partition = getPartition(fieldId, docId);
+        FieldInverter *inverter = partition._inverter;
+        _invertThreads.executeLambda(partition._executorId,
+                                     [inverter, docId, fv(std::move(fv))]()
+                                     { inverter->invertField(docId, fv); });
     }
     uint32_t urlId = 0;
     for (const auto & fi : _schemaIndexFields._uriFields) {
@@ -165,10 +182,11 @@ void
 DocumentInverter::removeDocument(uint32_t docId)
 {
     for (uint32_t fieldId : _schemaIndexFields._textFields) {
-        FieldInverter *inverter = _inverters[fieldId].get();
-        _invertThreads.execute(fieldId,
-                               [inverter, docId]()
-                               { inverter->removeDocument(docId); });
+        const FieldPartition &partition = getPartition(fieldId, docId);
+        FieldInverter *inverter = partition._inverter;
+        _invertThreads.executeLambda(partition._executorId,
+                                     [inverter, docId]()
+                                     { inverter->removeDocument(docId); });
     }
     uint32_t urlId = 0;
     for (const auto & fi : _schemaIndexFields._uriFields) {
@@ -193,16 +211,50 @@ DocumentInverter::pushDocuments(Dictionary &dict,
         MemoryFieldIndex &fieldIndex(**indexFieldIterator);
         DocumentRemover &remover(fieldIndex.getDocumentRemover());
         OrderedDocumentInserter &inserter(fieldIndex.getInserter());
-        _pushThreads.execute(fieldId,
-                             [inverter(inverter.get()), &remover, &inserter,
-                              &fieldIndex, onWriteDone]()
-                             { inverter->applyRemoves(remover);
-                                 inverter->pushDocuments(inserter);
-                                 fieldIndex.commit(); });
+        const FieldPartitions &partitions = _fieldPartitions[fieldId];
+        if (partitions.size() > 1) {
+            _pushThreads.execute(fieldId,
+                                 [this, &partitions, &remover, &inserter,
+                                  &fieldIndex, onWriteDone]()
+                                 { pushPartitions(partitions, remover, inserter);
+                                     fieldIndex.commit(); });
+        } else {
+            _pushThreads.execute(fieldId,
+                                 [inverter(inverter.get()), &remover, &inserter,
+                                  &fieldIndex, onWriteDone]()
+                                 { inverter->applyRemoves(remover);
+                                     inverter->pushDocuments(inserter);
+                                     fieldIndex.commit(); });
+        }
         ++indexFieldIterator;
         ++fieldId;
     }
 }
 
+
+void
+DocumentInverter::pushPartitions(const FieldPartitions &partitions,
+                                 DocumentRemover &remover,
+                                 IOrderedDocumentInserter &inserter)
+{
+    std::vector<FieldInverter *> inverters;
+    for (const auto &partition : partitions) {
+        partition._inverter->applyRemoves(remover);
+        inverters.push_back(partition._inverter);
+    }
+    // Sort other partitions in invert threads while sorting first partition here.
+    vespalib::CountDownLatch latch(partitions.size() - 1);
+    for (size_t i = 1; i < partitions.size(); ++i) {
+        FieldInverter *inverter = partitions[i]._inverter;
+        _invertThreads.executeLambda(partitions[i]._executorId,
+                                     [inverter, &latch]()
+                                     { inverter->sortDocuments();
+                                         latch.countDown(); });
+    }
+    inverters[0]->sortDocuments();
+    latch.await();
+    FieldInverter::mergeDocuments(inverters, inserter);
+}
+
 }
 
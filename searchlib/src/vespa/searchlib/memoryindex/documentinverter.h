@@ -21,6 +21,8 @@ namespace memoryindex
 class FieldInverter;
 class UrlFieldInverter;
 class Dictionary;
+class DocumentRemover;
+class IOrderedDocumentInserter;
 
 class DocumentInverter
 {
@@ -58,11 +60,48 @@ private:
 
     DocTypeBuilder::SchemaIndexFields  _schemaIndexFields;
 
+    /*
+     * A text field can be inverted in several partitions, spreading
+     * the work for a single large field over several invert threads.
+     * Documents are assigned to partitions by docId, and partition 0
+     * is the field inverter in _inverters.
+     */
+    struct FieldPartition
+    {
+        FieldInverter *_inverter;
+        uint32_t       _executorId;
+
+        FieldPartition(FieldInverter *inverter, uint32_t executorId)
+            : _inverter(inverter),
+              _executorId(executorId)
+        {
+        }
+    };
+    typedef std::vector<FieldPartition> FieldPartitions;
+
     std::vector<std::unique_ptr<FieldInverter>> _inverters;
     std::vector<std::unique_ptr<UrlFieldInverter>> _urlInverters;
+    std::vector<std::unique_ptr<FieldInverter>> _partitionInverters;
+    std::vector<FieldPartitions> _fieldPartitions; // indexed by field id
     ISequencedTaskExecutor &_invertThreads;
     ISequencedTaskExecutor &_pushThreads;
 
+    const FieldPartition &
+    getPartition(uint32_t fieldId, uint32_t docId) const
+    {
+        const FieldPartitions &partitions = _fieldPartitions[fieldId];
+        return partitions[docId % partitions.size()];
+    }
+
+    /*
+     * Apply removes and sort all partitions of a field, then merge
+     * them into the memory field index.  Called in push thread.
+     */
+    void
+    pushPartitions(const FieldPartitions &partitions,
+                   DocumentRemover &remover,
+                   IOrderedDocumentInserter &inserter);
+
     /**
      * Obtain the schema used by this index.
      *
@@ -79,10 +118,15 @@ public:
      * Create a new memory index based on the given schema.
      *
      * @param schema the index schema to use
+     * @param invertThreads executor used for inverting fields
+     * @param pushThreads executor used for pushing to memory field indexes,
+     *                    must be different from invertThreads
+     * @param numFieldPartitions number of partitions per text field
      */
     DocumentInverter(const index::Schema &schema,
                      ISequencedTaskExecutor &invertThreads,
-                     ISequencedTaskExecutor &pushThreads);
+                     ISequencedTaskExecutor &pushThreads,
+                     uint32_t numFieldPartitions = 1);
 
     ~DocumentInverter();
 
@@ -174,6 +174,7 @@ FieldInverter::reset()
     _abortedDocs.clear();
     _removeDocs.clear();
     _oldPosSize = 0u;
+    _pushPos = 0u;
 }
 
 struct WordRefRadix {
@@ -345,7 +346,8 @@ FieldInverter::FieldInverter(const Schema &schema, uint32_t fieldId)
       _terms(),
       _abortedDocs(),
       _pendingDocs(),
-      _removeDocs()
+      _removeDocs(),
+      _pushPos(0u)
 {
 }
 
@@ -487,12 +489,11 @@ FieldInverter::applyRemoves(DocumentRemover &remover)
 
 
 void
-FieldInverter::pushDocuments(IOrderedDocumentInserter &inserter)
+FieldInverter::sortDocuments()
 {
     trimAbortedDocs();
 
     if (_positions.empty()) {
-        reset();
         return;				// All documents with words aborted
     }
 
@@ -501,67 +502,121 @@ FieldInverter::pushDocuments(IOrderedDocumentInserter &inserter)
     // Sort for terms.
     ShiftBasedRadixSorter<PosInfo, FullRadix, std::less<PosInfo>, 56, true>::
         radix_sort(FullRadix(), std::less<PosInfo>(), &_positions[0], _positions.size(), 16);
+    _pushPos = 0u;
+}
 
+
+void
+FieldInverter::pushPosting(IOrderedDocumentInserter &inserter)
+{
     constexpr uint32_t NO_ELEMENT_ID = std::numeric_limits<uint32_t>::max();
     constexpr uint32_t NO_WORD_POS = std::numeric_limits<uint32_t>::max();
+    const PosInfo *i = &_positions[_pushPos];
+    const PosInfo *ie = &_positions[0] + _positions.size();
+    const uint32_t wordNum = i->_wordNum;
+    const uint32_t docId = i->_docId;
+    assert(wordNum < _wordRefs.size());
+    if (i->removed()) {
+        inserter.remove(docId);
+        while (i != ie && i->_wordNum == wordNum && i->_docId == docId &&
+               i->removed()) {
+            ++i;		// ignore dup remove
+        }
+    }
+    if (i != ie && i->_wordNum == wordNum && i->_docId == docId) {
+        uint32_t lastElemId = NO_ELEMENT_ID;
+        uint32_t lastWordPos = NO_WORD_POS;
+        _features.clear(docId);
+        for (; i != ie && i->_wordNum == wordNum && i->_docId == docId; ++i) {
+            // removes must come before non-removes
+            assert(!i->removed());
+            const ElemInfo &elem = _elems[i->_elemRef];
+            if (i->_wordPos != lastWordPos || i->_elemId != lastElemId) {
+                _features.addNextOcc(i->_elemId, i->_wordPos,
+                                     elem._weight, elem._len);
+                lastElemId = i->_elemId;
+                lastWordPos = i->_wordPos;
+            } else {
+                // silently ignore duplicate annotations
+            }
+        }
+        inserter.add(docId, _features);
+    }
+    _pushPos = i - &_positions[0];
+}
+
+
+void
+FieldInverter::pushDocuments(IOrderedDocumentInserter &inserter)
+{
+    sortDocuments();
+
+    if (_positions.empty()) {
+        reset();
+        return;				// All documents with words aborted
+    }
+
     uint32_t lastWordNum = 0;
-    uint32_t lastElemId = 0;
-    uint32_t lastWordPos = 0;
-    uint32_t numWordIds = _wordRefs.size() - 1;
-    uint32_t lastDocId = 0;
-    vespalib::stringref word;
-    bool emptyFeatures = true;
 
     inserter.rewind();
 
-    for (auto &i : _positions) {
-        assert(i._wordNum <= numWordIds);
-        (void) numWordIds;
-        if (lastWordNum != i._wordNum || lastDocId != i._docId) {
-            if (!emptyFeatures) {
-                inserter.add(lastDocId, _features);
-                emptyFeatures = true;
-            }
-            if (lastWordNum != i._wordNum) {
-                lastWordNum = i._wordNum;
-                word = getWordFromNum(lastWordNum);
-                inserter.setNextWord(word);
+    while (hasMorePostings()) {
+        uint32_t wordNum = _positions[_pushPos]._wordNum;
+        if (wordNum != lastWordNum) {
+            lastWordNum = wordNum;
+            inserter.setNextWord(getWordFromNum(lastWordNum));
+        }
+        pushPosting(inserter);
+    }
+    inserter.flush();
+    reset();
+}
+
+
+void
+FieldInverter::mergeDocuments(const std::vector<FieldInverter *> &inverters,
+                              IOrderedDocumentInserter &inserter)
+{
+    bool empty = true;
+    for (const auto inverter : inverters) {
+        if (inverter->hasMorePostings()) {
+            empty = false;
+        }
+    }
+    if (!empty) {
+        const char *lastWord = nullptr;
+        inserter.rewind();
+        for (;;) {
+            // Few partitions, a linear scan for the smallest posting is fine
+            FieldInverter *next = nullptr;
+            const char *nextWord = nullptr;
+            for (const auto inverter : inverters) {
+                if (!inverter->hasMorePostings()) {
+                    continue;
+                }
+                const char *word = inverter->getPostingWord();
+                int cmpres = (next != nullptr) ? strcmp(word, nextWord) : -1;
+                if (cmpres < 0 ||
+                    (cmpres == 0 &&
+                     inverter->getPostingDocId() < next->getPostingDocId())) {
+                    next = inverter;
+                    nextWord = word;
+                }
             }
-            lastDocId = i._docId;
-            if (i.removed()) {
-                inserter.remove(lastDocId);
-                continue;
+            if (next == nullptr) {
+                break;
             }
-        }
-        if (emptyFeatures) {
-            if (!i.removed()) {
-                emptyFeatures = false;
-                _features.clear(lastDocId);
-                lastElemId = NO_ELEMENT_ID;
-                lastWordPos = NO_WORD_POS;
-            } else {
-                continue; // ignore dup remove
+            if (lastWord == nullptr || strcmp(lastWord, nextWord) != 0) {
+                inserter.setNextWord(nextWord);
+                lastWord = nextWord;
             }
-        } else {
-            // removes must come before non-removes
-            assert(!i.removed());
-        }
-        const ElemInfo &elem = _elems[i._elemRef];
-        if (i._wordPos != lastWordPos || i._elemId != lastElemId) {
-            _features.addNextOcc(i._elemId, i._wordPos,
-                                 elem._weight, elem._len);
-            lastElemId = i._elemId;
-            lastWordPos = i._wordPos;
-        } else {
-            // silently ignore duplicate annotations
+            next->pushPosting(inserter);
         }
+        inserter.flush();
     }
-
-    if (!emptyFeatures) {
-        inserter.add(lastDocId, _features);
+    for (auto inverter : inverters) {
+        inverter->reset();
     }
-    inserter.flush();
-    reset();
 }
 
 
@@ -199,6 +199,9 @@ private:
     std::map<uint32_t, PositionRange> _pendingDocs;
     std::vector<uint32_t>             _removeDocs;
 
+    // Next position to push, after positions have been sorted
+    size_t                            _pushPos;
+
     void
     invertNormalDocTextField(const document::FieldValue &val);
 
@@ -363,6 +366,37 @@ private:
     void
     abortPendingDoc(uint32_t docId);
 
+    bool
+    hasMorePostings() const
+    {
+        return _pushPos < _positions.size();
+    }
+
+    /*
+     * Get word for next (word, docId) tuple to be pushed.
+     */
+    const char *
+    getPostingWord() const
+    {
+        return getWordFromNum(_positions[_pushPos]._wordNum);
+    }
+
+    /*
+     * Get docId for next (word, docId) tuple to be pushed.
+     */
+    uint32_t
+    getPostingDocId() const
+    {
+        return _positions[_pushPos]._docId;
+    }
+
+    /*
+     * Push next (word, docId) tuple to inserter, with all its
+     * positions.  Caller has already set the word in the inserter.
+     */
+    void
+    pushPosting(IOrderedDocumentInserter &inserter);
+
 public:
     /**
      * Create a new memory index based on the given schema.
@@ -391,6 +425,29 @@ public:
     void
     pushDocuments(IOrderedDocumentInserter &inserter);
 
+    /*
+     * Trim aborted documents and sort words and positions, preparing
+     * for a push of inverted documents.  Field inverters for
+     * different partitions of the same field can be sorted in
+     * parallel before their documents are merged.
+     */
+    void
+    sortDocuments();
+
+    /**
+     * Push inverted documents from field inverters for different
+     * partitions of the same field to memory index structure.  All
+     * field inverters must have been sorted by sortDocuments() and
+     * must have disjoint sets of documents.  The sorted runs are
+     * merged by (word, docId) in a single pass over the dictionary.
+     *
+     * @param inverters field inverters for the partitions of a field
+     * @param inserter  ordered document inserter
+     */
+    static void
+    mergeDocuments(const std::vector<FieldInverter *> &inverters,
+                   IOrderedDocumentInserter &inserter);
+
     /*
      * Invert a normal text field, based on annotations.
      */
@@ -8,6 +8,7 @@
 #include <vespa/searchlib/queryeval/emptysearch.h>
 #include <vespa/searchlib/queryeval/leaf_blueprints.h>
 #include <vespa/searchlib/common/sequencedtaskexecutor.h>
+#include <vespa/searchlib/common/idestructorcallback.h>
 #include <vespa/searchlib/btree/btreenodeallocator.hpp>
 
 #include <vespa/log/log.h>
@@ -49,12 +50,13 @@ namespace memoryindex {
 
 MemoryIndex::MemoryIndex(const Schema &schema,
                          ISequencedTaskExecutor &invertThreads,
-                         ISequencedTaskExecutor &pushThreads)
+                         ISequencedTaskExecutor &pushThreads,
+                         uint32_t numFieldPartitions)
     : _schema(schema),
       _invertThreads(invertThreads),
       _pushThreads(pushThreads),
-      _inverter0(_schema, _invertThreads, _pushThreads),
-      _inverter1(_schema, _invertThreads, _pushThreads),
+      _inverter0(_schema, _invertThreads, _pushThreads, numFieldPartitions),
+      _inverter1(_schema, _invertThreads, _pushThreads, numFieldPartitions),
       _inverter(&_inverter0),
       _dictionary(_schema),
       _frozen(false),
@@ -64,6 +66,10 @@ MemoryIndex::MemoryIndex(const Schema &schema,
       _hiddenFields(schema.getNumIndexFields(), false),
       _prunedSchema(),
       _indexedDocs(0),
+      _bulkLoadDocs(0),
+      _bufferedDocs(0),
+      _bulkLoadCallbacks(),
+      _deferredCommit(false),
       _staticMemoryFootprint(getMemoryUsage().allocatedBytes())
 {
 }
@@ -84,6 +90,7 @@ MemoryIndex::insertDocument(uint32_t docId, const document::Document &doc)
     }
     updateMaxDocId(docId);
     _inverter->invertDocument(docId, doc);
+    ++_bufferedDocs;
     if (_indexedDocs.insert(docId).second) {
         incNumDocs();
     }
@@ -98,21 +105,71 @@ MemoryIndex::removeDocument(uint32_t docId)
         return;
     }
     _inverter->removeDocument(docId);
+    ++_bufferedDocs;
     if (_indexedDocs.find(docId) != _indexedDocs.end()) {
         _indexedDocs.erase(docId);
         decNumDocs();
     }
 }
 
+namespace {
+
+/*
+ * Keeps completion callbacks for commits deferred by bulk load mode
+ * alive until the documents have been pushed.
+ */
+class BulkLoadCallbacks : public IDestructorCallback
+{
+    std::vector<std::shared_ptr<IDestructorCallback>> _callbacks;
+public:
+    BulkLoadCallbacks(std::vector<std::shared_ptr<IDestructorCallback>> callbacks)
+        : _callbacks(std::move(callbacks))
+    {
+    }
+};
+
+}
+
 void
 MemoryIndex::commit(const std::shared_ptr<IDestructorCallback> &onWriteDone)
 {
+    if (_bufferedDocs < _bulkLoadDocs && _bulkLoadCallbacks.size() < _bulkLoadDocs) {
+        _deferredCommit = true;
+        if (onWriteDone) {
+            _bulkLoadCallbacks.push_back(onWriteDone);
+        }
+        return;
+    }
+    pushDocuments(onWriteDone);
+}
+
+void
+MemoryIndex::pushDocuments(const std::shared_ptr<IDestructorCallback> &onWriteDone)
+{
+    std::shared_ptr<IDestructorCallback> callback(onWriteDone);
+    if (!_bulkLoadCallbacks.empty()) {
+        if (onWriteDone) {
+            _bulkLoadCallbacks.push_back(onWriteDone);
+        }
+        callback = std::make_shared<BulkLoadCallbacks>(std::move(_bulkLoadCallbacks));
+        _bulkLoadCallbacks.clear();
+    }
     _invertThreads.sync(); // drain inverting into this inverter
     _pushThreads.sync(); // drain use of other inverter
-    _inverter->pushDocuments(_dictionary, onWriteDone);
+    _inverter->pushDocuments(_dictionary, callback);
     flipInverter();
+    _bufferedDocs = 0;
+    _deferredCommit = false;
 }
 
+void
+MemoryIndex::setBulkLoad(uint32_t bulkLoadDocs)
+{
+    _bulkLoadDocs = bulkLoadDocs;
+    if (_bulkLoadDocs == 0 && _deferredCommit) {
+        pushDocuments(std::shared_ptr<IDestructorCallback>());
+    }
+}
 
 void
 MemoryIndex::flipInverter()
@@ -127,6 +184,10 @@ MemoryIndex::flipInverter()
 void
 MemoryIndex::freeze()
 {
+    if (_deferredCommit) {
+        pushDocuments(std::shared_ptr<IDestructorCallback>());
+        _pushThreads.sync();
+    }
     _frozen = true;
 }
 
@@ -38,6 +38,10 @@ private:
     std::vector<bool> _hiddenFields;
     index::Schema::SP _prunedSchema;
     vespalib::hash_set<uint32_t> _indexedDocs; // documents in memory index
+    uint32_t          _bulkLoadDocs;   // buffered documents before push, 0 when not bulk loading
+    uint32_t          _bufferedDocs;   // documents inverted since last push
+    std::vector<std::shared_ptr<IDestructorCallback>> _bulkLoadCallbacks;
+    bool              _deferredCommit; // commit deferred by bulk load mode
     const uint64_t    _staticMemoryFootprint;
 
     MemoryIndex(const MemoryIndex &) = delete;
@@ -61,6 +65,7 @@ private:
     }
 
     void flipInverter();
+    void pushDocuments(const std::shared_ptr<IDestructorCallback> &onWriteDone);
 
 public:
     /**
@@ -73,10 +78,13 @@ public:
      * Create a new memory index based on the given schema.
      *
      * @param schema the index schema to use
+     * @param numFieldPartitions number of partitions per text field,
+     *                           each inverted by its own invert thread
      **/
     MemoryIndex(const index::Schema &schema,
                 ISequencedTaskExecutor &invertThreads,
-                ISequencedTaskExecutor &pushThreads);
+                ISequencedTaskExecutor &pushThreads,
+                uint32_t numFieldPartitions = 1);
 
     /**
      * Class destructor.  Clean up washlist.
@@ -122,10 +130,28 @@ public:
      **/
     void commit(const std::shared_ptr<IDestructorCallback> &onWriteDone);
 
+    /**
+     * Set bulk load mode, used when feeding an empty index, e.g. during
+     * initial feed or reindexing. In bulk load mode, commits are deferred
+     * until at least bulkLoadDocs documents have been inserted or removed.
+     * Each push then contains large sorted runs per word, and new posting
+     * lists are built in one pass by the btree builder instead of by
+     * incremental inserts. Documents are not searchable and completion
+     * callbacks are held until pushed. At most bulkLoadDocs commits are
+     * deferred before pushing. Deferred documents are pushed when bulk
+     * load mode is turned off (bulkLoadDocs = 0) or when this index is
+     * frozen.
+     *
+     * Must be called by the thread inserting and removing documents.
+     **/
+    void setBulkLoad(uint32_t bulkLoadDocs);
+    bool isBulkLoad() const { return _bulkLoadDocs != 0; }
+
     /**
      * Freeze this index. Further index updates will be
      * discarded. Extra information kept to wash the posting lists
-     * will be discarded.
+     * will be discarded. Documents deferred by bulk load mode are
+     * pushed first.
      **/
     void freeze();
 
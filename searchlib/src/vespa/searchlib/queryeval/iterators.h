@@ -25,6 +25,7 @@ protected:
     void clearUnpacked()           { _needUnpack = 1; }
     uint32_t getNeedUnpack() const { return _needUnpack; }
     void incNeedUnpack()           { ++_needUnpack; }
+    void incNeedUnpack(uint32_t n) { _needUnpack += n; }
 
 public:
     RankedSearchIteratorBase(const fef::TermFieldMatchDataArray &matchData);
@@ -14,6 +14,8 @@
 namespace search {
 namespace queryeval {
 
+using vespalib::hwaccelrated::IAccelrated;
+
 namespace {
 
 template<typename Update>
@@ -23,6 +25,8 @@ public:
     MultiBitVectorIterator(const Children & children) : MultiBitVectorIteratorBase(children) { }
 protected:
     void updateLastValue(uint32_t docId);
+    void updateLastBlockValue(uint32_t docId);
+    uint32_t nextCandidate() const;
     void strictSeek(uint32_t docId);
 private:
     void doSeek(uint32_t docId) override;
@@ -58,6 +62,25 @@ void MultiBitVectorIterator<Update>::updateLastValue(uint32_t docId)
     }
 }
 
+template<typename Update>
+void MultiBitVectorIterator<Update>::updateLastBlockValue(uint32_t docId)
+{
+    if (docId >= _lastMaxDocIdLimit) {
+        if (__builtin_expect(docId < _numDocs, true)) {
+            const uint32_t index(wordNum(docId));
+            if ( ! isInBlock(index)) {
+                _blockStart = index;
+                _blockEnd = std::min(index + BlockWords, wordNum(_numDocs - 1) + 1);
+                Update::combine(*_accel, _block, &_bvs[0], _bvs.size(), _blockStart, _blockEnd - _blockStart);
+            }
+            _lastValue = _block[index - _blockStart];
+            _lastMaxDocIdLimit = (index + 1) * WordLen;
+        } else {
+            setAtEnd();
+        }
+    }
+}
+
 template<typename Update>
 void
 MultiBitVectorIterator<Update>::doSeek(uint32_t docId)
@@ -70,13 +93,26 @@ MultiBitVectorIterator<Update>::doSeek(uint32_t docId)
     }
 }
 
+template<typename Update>
+uint32_t
+MultiBitVectorIterator<Update>::nextCandidate() const
+{
+    // Skip all empty words left in the combined block in one go.
+    const uint32_t index(wordNum(_lastMaxDocIdLimit));
+    if (index >= _blockEnd) {
+        return _lastMaxDocIdLimit;
+    }
+    const size_t bit = _accel->nextSetBit(_block, (index - _blockStart) * WordLen, (_blockEnd - _blockStart) * WordLen);
+    return (_blockStart + wordNum(bit)) * WordLen;
+}
+
 template<typename Update>
 void
 MultiBitVectorIterator<Update>::strictSeek(uint32_t docId)
 {
-    for (updateLastValue(docId), _lastValue=_lastValue & checkTab(docId);
+    for (updateLastBlockValue(docId), _lastValue=_lastValue & checkTab(docId);
          (_lastValue == 0) && __builtin_expect(! isAtEnd(), true);
-         updateLastValue(_lastMaxDocIdLimit));
+         updateLastBlockValue(nextCandidate()));
     if (__builtin_expect(!isAtEnd(), true)) {
         docId = _lastMaxDocIdLimit - WordLen + vespalib::Optimized::lsbIdx(_lastValue);
         if (__builtin_expect(docId >= _numDocs, false)) {
@@ -92,6 +128,10 @@ struct And {
     Word operator () (const Word a, const Word b) {
         return a & b;
     }
+    static void combine(const IAccelrated & accel, Word * dest, const Word * const * src, size_t numSrc,
+                        size_t offset, size_t sz) {
+        accel.andWords(dest, src, numSrc, offset, sz);
+    }
     static bool isAnd() { return true; }
 };
 
@@ -100,6 +140,10 @@ struct Or {
     Word operator () (const Word a, const Word b) {
         return a | b;
     }
+    static void combine(const IAccelrated & accel, Word * dest, const Word * const * src, size_t numSrc,
+                        size_t offset, size_t sz) {
+        accel.orWords(dest, src, numSrc, offset, sz);
+    }
     static bool isAnd() { return false; }
 };
 
@@ -137,7 +181,10 @@ MultiBitVectorIteratorBase::MultiBitVectorIteratorBase(const Children & children
     _numDocs(std::numeric_limits<unsigned int>::max()),
     _lastValue(0),
     _lastMaxDocIdLimit(0),
-    _bvs(children.size())
+    _bvs(children.size()),
+    _accel(IAccelrated::getAccelrator()),
+    _blockStart(0),
+    _blockEnd(0)
 {
     for (size_t i(0); i < children.size(); i++) {
         const BitVectorIterator * bv = static_cast<const BitVectorIterator *>(children[i]);
@@ -159,6 +206,7 @@ MultiBitVectorIteratorBase::andWith(UP filter, uint32_t estimate)
         _bvs.push_back(reinterpret_cast<const Word *>(bv.getBitValues()));
         insert(getChildren().size(), std::move(filter));
         _lastMaxDocIdLimit = 0;  // force reload
+        invalidateBlock();
     }
     return filter;
 }
@@ -5,6 +5,7 @@
 #include "multisearch.h"
 #include "unpackinfo.h"
 #include <vespa/searchlib/common/bitword.h>
+#include <vespa/vespalib/hwaccelrated/iaccelrated.h>
 
 namespace search {
 namespace queryeval {
@@ -23,10 +24,24 @@ public:
 protected:
     MultiBitVectorIteratorBase(const Children & children);
 
+    /**
+     * Number of words combined in one pass when seeking strictly.
+     * Strict seeks consume words in order, so combining a block at a time
+     * amortizes the per word cost over all the underlying bitvectors.
+     */
+    static constexpr uint32_t BlockWords = 32;
+
+    void invalidateBlock() { _blockStart = _blockEnd = 0; }
+    bool isInBlock(uint32_t wordIndex) const { return (wordIndex >= _blockStart) && (wordIndex < _blockEnd); }
+
     uint32_t                _numDocs;
     Word                    _lastValue; // Last value computed
     uint32_t                _lastMaxDocIdLimit; // next documentid requiring recomputation.
     std::vector<const Word  *> _bvs;
+    vespalib::hwaccelrated::IAccelrated::UP _accel;
+    uint32_t                _blockStart; // First word index in _block
+    uint32_t                _blockEnd;   // One past last valid word index in _block
+    Word                    _block[BlockWords];
 private:
     virtual bool acceptExtraFilter() const = 0;
     UP andWith(UP filter, uint32_t estimate) override;
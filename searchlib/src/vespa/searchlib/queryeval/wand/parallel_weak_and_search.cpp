@@ -44,7 +44,9 @@ private:
     void seek_strict(uint32_t docid) {
         _algo.set_candidate(_terms, _heaps, docid);
         while (_algo.solve_wand_constraint(_terms, _heaps, GreaterThan(_boostedThreshold))) {
-            if (_algo.check_score(_terms, _heaps, DotProductScorer(), GreaterThan(_threshold))) {
+            if (VectorizedTerms::has_block_max && !_algo.check_block_max(_terms, _heaps, GreaterThan(_threshold))) {
+                _algo.set_candidate(_terms, _heaps, _algo.get_block_skip_target(_terms, _heaps));
+            } else if (_algo.check_score(_terms, _heaps, DotProductScorer(), GreaterThan(_threshold))) {
                 setDocId(_algo.get_candidate());
                 return;
             } else {
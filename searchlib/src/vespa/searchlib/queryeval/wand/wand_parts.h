@@ -243,6 +243,12 @@ public:
     VectorizedIteratorTerms & operator=(VectorizedIteratorTerms &&);
 
     ~VectorizedIteratorTerms();
+
+    // generic search iterators have no block information; the block is the current docid only
+    static constexpr bool has_block_max = false;
+    score_t blockMaxScore(ref_t ref) const { return maxScore(ref); }
+    docid_t blockLastDocId(ref_t ref) { return docId(ref); }
+
     void unpack(uint16_t ref, uint32_t docid) { iteratorPack().unpack(ref, docid); }
     void visit_members(vespalib::ObjectVisitor &visitor) const;
     const Terms &input_terms() const { return _terms; }
@@ -279,6 +285,15 @@ struct VectorizedAttributeTerms : VectorizedState<AttributeIteratorPack> {
         }
         iteratorPack() = AttributeIteratorPack(std::move(iterators));
     }
+
+    // upper bound and last docid of the posting list block containing the current position of a term
+    static constexpr bool has_block_max = true;
+    score_t blockMaxScore(ref_t ref) {
+        score_t w = weight(ref);
+        return w * ((w >= 0) ? iteratorPack().get_block_max_weight(ref) : iteratorPack().get_block_min_weight(ref));
+    }
+    docid_t blockLastDocId(ref_t ref) { return iteratorPack().get_block_last_docid(ref); }
+
     void visit_members(vespalib::ObjectVisitor &) const {}
 };
 
@@ -616,6 +631,43 @@ public:
         return true;
     }
 
+    /**
+     * Block-max check of the current candidate. Replaces the global max
+     * score of each present term with the max score of the posting list
+     * block it is positioned in. Only valid right after the wand
+     * constraint is solved.
+     **/
+    template <typename VectorizedTerms, typename Heaps, typename AboveThreshold>
+    bool check_block_max(VectorizedTerms &terms, Heaps &heaps, AboveThreshold &&aboveThreshold) {
+        score_t max_score = _maxUpperBound;
+        ref_t *end = heaps.present_end();
+        for (ref_t *ref = heaps.present_begin(); ref != end; ++ref) {
+            max_score -= (terms.maxScore(*ref) - terms.blockMaxScore(*ref));
+        }
+        return aboveThreshold(max_score);
+    }
+
+    /**
+     * The first docid that may pass the block-max check after it failed
+     * for the current candidate: the end of the nearest present block or
+     * the next future term, whichever comes first.
+     **/
+    template <typename VectorizedTerms, typename Heaps>
+    docid_t get_block_skip_target(VectorizedTerms &terms, Heaps &heaps) {
+        if (!heaps.has_present()) {
+            return _candidate + 1;
+        }
+        docid_t target = search::endDocId;
+        ref_t *end = heaps.present_end();
+        for (ref_t *ref = heaps.present_begin(); ref != end; ++ref) {
+            target = std::min(target, terms.blockLastDocId(*ref) + 1);
+        }
+        if (heaps.has_future()) {
+            target = std::min(target, terms.docId(heaps.future()));
+        }
+        return target;
+    }
+
     template <typename VectorizedTerms, typename Heaps, typename Scorer, typename AboveThreshold>
     bool check_score(VectorizedTerms &terms, Heaps &heaps, Scorer &&scorer, AboveThreshold &&aboveThreshold) {
         _partial_score = 0;
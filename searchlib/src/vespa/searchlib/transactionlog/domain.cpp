@@ -47,7 +47,11 @@ Domain::Domain(const string &domainName,
     _sessions(),
     _baseDir(baseDir),
     _fileHeaderContext(fileHeaderContext),
-    _markedDeleted(false)
+    _markedDeleted(false),
+    _pendingCommitLock(),
+    _pendingCommits(),
+    _commitInProgress(false),
+    _singleCommitter(1, 128*1024)
 {
     int retval(0);
     if ((retval = makeDirectory(_baseDir.c_str())) != 0) {
@@ -65,12 +69,13 @@ Domain::Domain(const string &domainName,
     }
     _executor.sync();
     if (_parts.empty() || _parts.crbegin()->second->isClosed()) {
-        _parts[lastPart].reset(new DomainPart(_name, dir(), lastPart, _useFsync, _defaultCrcType, _fileHeaderContext, false));
+        _parts[lastPart].reset(new DomainPart(_name, dir(), lastPart, _defaultCrcType, _fileHeaderContext, false));
     }
+    _parts.rbegin()->second->preallocate(_domainPartSize);
 }
 
 void Domain::addPart(int64_t partId, bool isLastPart) {
-    DomainPart::SP dp(new DomainPart(_name, dir(), partId, _useFsync, _defaultCrcType, _fileHeaderContext, isLastPart));
+    DomainPart::SP dp(new DomainPart(_name, dir(), partId, _defaultCrcType, _fileHeaderContext, isLastPart));
     if (dp->size() == 0) {
         // Only last domain part is allowed to be truncated down to
         // empty size.
@@ -108,7 +113,10 @@ private:
     bool              & _pendingSync;
 };
 
-Domain::~Domain() { }
+Domain::~Domain()
+{
+    _singleCommitter.shutdown().sync();
+}
 
 DomainInfo
 Domain::getDomainInfo() const
@@ -203,11 +211,17 @@ Domain::triggerSyncNow()
     MonitorGuard guard(_syncMonitor);
     if (!_pendingSync) {
         _pendingSync = true;
-        DomainPart::SP dp(_parts.rbegin()->second);
+        DomainPart::SP dp(getActivePart());
         _executor.execute(Sync::UP(new Sync(_syncMonitor, dp, _pendingSync)));
     }
 }
 
+DomainPart::SP Domain::getActivePart() const
+{
+    LockGuard guard(_lock);
+    return _parts.rbegin()->second;
+}
+
 DomainPart::SP Domain::findPart(SerialNum s)
 {
     LockGuard guard(_lock);
@@ -274,7 +288,82 @@ void Domain::cleanSessions()
 
 void Domain::commit(const Packet & packet)
 {
-    DomainPart::SP dp(_parts.rbegin()->second);
+    vespalib::Gate gate;
+    string error;
+    commit(packet, [&gate, &error](const string & msg) {
+        error = msg;
+        gate.countDown();
+    });
+    gate.await();
+    if ( ! error.empty()) {
+        throw runtime_error(error);
+    }
+}
+
+void Domain::commit(const Packet & packet, DoneCallback onDone)
+{
+    LockGuard guard(_pendingCommitLock);
+    _pendingCommits.emplace_back(packet, std::move(onDone));
+    if ( ! _commitInProgress) {
+        _commitInProgress = true;
+        _singleCommitter.execute(makeTask(makeClosure(this, &Domain::doCommits)));
+    }
+}
+
+void Domain::doCommits()
+{
+    PendingCommits commits;
+    {
+        LockGuard guard(_pendingCommitLock);
+        commits.swap(_pendingCommits);
+    }
+    std::vector<string> errors(commits.size());
+    for (size_t i(0); i < commits.size(); i++) {
+        try {
+            commitPacket(commits[i].packet);
+        } catch (const std::exception & e) {
+            errors[i] = e.what();
+        }
+    }
+    if (_useFsync) {
+        try {
+            getActivePart()->sync();
+        } catch (const std::exception & e) {
+            for (string & error : errors) {
+                error = e.what();
+            }
+        }
+    }
+    cleanSessions();
+    for (size_t i(0); i < commits.size(); i++) {
+        if (errors[i].empty()) {
+            notifySessions(commits[i].packet);
+        }
+        try {
+            commits[i].onDone(errors[i]);
+        } catch (const std::exception & e) {
+            LOG(error, "Commit callback for domain '%s' failed: %s", _name.c_str(), e.what());
+        }
+    }
+    // Commits queued meanwhile are handled by a new task, letting prune run in between.
+    Executor::Task::UP task;
+    {
+        LockGuard guard(_pendingCommitLock);
+        if (_pendingCommits.empty()) {
+            _commitInProgress = false;
+            return;
+        }
+        task = _singleCommitter.execute(makeTask(makeClosure(this, &Domain::doCommits)));
+    }
+    if (task) {
+        // Shutting down, finish the remaining commits in this thread.
+        task->run();
+    }
+}
+
+void Domain::commitPacket(const Packet & packet)
+{
+    DomainPart::SP dp(getActivePart());
     vespalib::nbostream_longlivedbuf is(packet.getHandle().c_str(), packet.getHandle().size());
     Packet::Entry entry;
     entry.deserialize(is);
@@ -287,22 +376,25 @@ void Domain::commit(const Packet & packet)
             }
         }
         dp->close();
-        dp.reset(new DomainPart(_name, dir(), entry.serial(), _useFsync, _defaultCrcType, _fileHeaderContext, false));
+        dp.reset(new DomainPart(_name, dir(), entry.serial(), _defaultCrcType, _fileHeaderContext, false));
+        dp->preallocate(_domainPartSize);
         {
             LockGuard guard(_lock);
             _parts[entry.serial()] = dp;
         }
-        dp = _parts.rbegin()->second;
     }
     dp->commit(entry.serial(), packet);
-    cleanSessions();
+}
 
+void Domain::notifySessions(const Packet & packet)
+{
+    SerialNum firstSerial(packet.range().from());
     LockGuard guard(_sessionLock);
     for (auto & it : _sessions) {
         const Session::SP & session(it.second);
         if (session->continous()) {
             if (session->ok()) {
-                Session::enQ(session, entry.serial(), packet);
+                Session::enQ(session, firstSerial, packet);
             }
         }
     }
@@ -310,20 +402,34 @@ void Domain::commit(const Packet & packet)
 
 bool Domain::erase(const SerialNum & to)
 {
+    // Parts are erased by the committer, so a part is never erased while a commit is written to it.
     bool retval(true);
-    /// Do not erase the last element
-    for (DomainPartList::iterator it(_parts.begin()); (_parts.size() > 1) && (it->second.get()->range().to() < to); it = _parts.begin()) {
-        DomainPart::SP dp(it->second);
-        {
-            LockGuard guard(_lock);
+    vespalib::Gate gate;
+    _singleCommitter.execute(makeTask(makeClosure(this, &Domain::doErase, SerialNum(to), &retval, &gate)));
+    gate.await();
+    return retval;
+}
+
+void Domain::doErase(SerialNum to, bool *retval, vespalib::Gate *done)
+{
+    std::vector<DomainPart::SP> erased;
+    DomainPart::SP first;
+    {
+        LockGuard guard(_lock);
+        /// Do not erase the last element
+        for (DomainPartList::iterator it(_parts.begin()); (_parts.size() > 1) && (it->second->range().to() < to); it = _parts.begin()) {
+            erased.push_back(it->second);
             _parts.erase(it);
         }
-        retval = retval && dp->erase(to);
+        first = _parts.begin()->second;
     }
-    if (_parts.begin()->second->range().to() >= to) {
-        _parts.begin()->second->erase(to);
+    for (const DomainPart::SP & dp : erased) {
+        *retval = *retval && dp->erase(to);
     }
-    return retval;
+    if (first->range().to() >= to) {
+        first->erase(to);
+    }
+    done->countDown();
 }
 
 int Domain::visit(const Domain::SP & domain, const SerialNum & from, const SerialNum & to, FRT_Supervisor & supervisor, FNET_Connection *conn)
@@ -4,6 +4,7 @@
 #include <vespa/searchlib/transactionlog/domainpart.h>
 #include <vespa/searchlib/transactionlog/session.h>
 #include <vespa/vespalib/util/threadstackexecutor.h>
+#include <functional>
 
 namespace search {
 namespace transactionlog {
@@ -37,6 +38,11 @@ class Domain
 {
 public:
     typedef std::shared_ptr<Domain> SP;
+    /**
+     * Called when a commit has been written, and synced if fsync is used.
+     * The error message is empty if the commit succeeded.
+     */
+    using DoneCallback = std::function<void(const vespalib::string & error)>;
     Domain(const vespalib::string &name,
            const vespalib::string &baseDir,
            vespalib::ThreadStackExecutor & executor,
@@ -52,7 +58,17 @@ public:
     const vespalib::string & name() const { return _name; }
     bool erase(const SerialNum & to);
 
+    /**
+     * Commit the packet and wait until it has been written, and synced if fsync is used.
+     * Throws if the commit failed.
+     */
     void commit(const Packet & packet);
+    /**
+     * Queue the packet for commit and return at once. All packets queued while a
+     * commit is in progress are written together with a single sync, before their
+     * callbacks are called in the order they were queued.
+     */
+    void commit(const Packet & packet, DoneCallback onDone);
     int
     visit(const Domain::SP & self,
           const SerialNum & from,
@@ -94,6 +110,11 @@ private:
     void cleanSessions();
     vespalib::string dir() const { return getDir(_baseDir, _name); }
     void addPart(int64_t partId, bool isLastPart);
+    void doCommits();
+    void doErase(SerialNum to, bool *retval, vespalib::Gate *done);
+    DomainPart::SP getActivePart() const;
+    void commitPacket(const Packet & packet);
+    void notifySessions(const Packet & packet);
 
     typedef std::vector<SerialNum> SerialNumList;
 
@@ -103,6 +124,14 @@ private:
     typedef std::map<int64_t, DomainPart::SP > DomainPartList;
     typedef vespalib::ThreadStackExecutor Executor;
 
+    struct PendingCommit {
+        Packet       packet;
+        DoneCallback onDone;
+        PendingCommit(const Packet & packet_in, DoneCallback onDone_in)
+            : packet(packet_in), onDone(std::move(onDone_in)) {}
+    };
+    typedef std::vector<PendingCommit> PendingCommits;
+
     DomainPart::Crc     _defaultCrcType;
     Executor          & _executor;
     std::atomic<int>    _sessionId;
@@ -119,6 +148,10 @@ private:
     const common::FileHeaderContext &_fileHeaderContext;
     bool                _markedDeleted;
     bool                _urgentSync;
+    vespalib::Lock      _pendingCommitLock;
+    PendingCommits      _pendingCommits;
+    bool                _commitInProgress;
+    Executor            _singleCommitter;
 };
 
 }
@@ -8,6 +8,7 @@
 #include <vespa/vespalib/data/fileheader.h>
 #include <vespa/searchlib/common/fileheadercontext.h>
 #include <vespa/fastlib/io/bufferedfile.h>
+#include <fcntl.h>
 #include <vespa/log/log.h>
 
 LOG_SETUP(".transactionlog.domainpart");
@@ -38,7 +39,7 @@ string
 handleWriteError(const char *text,
                  FastOS_FileInterface &file,
                  int64_t lastKnownGoodPos,
-                 const Packet::Entry &entry,
+                 SerialNum lastSerial,
                  int bufLen) __attribute__ ((noinline));
 
 bool
@@ -79,13 +80,13 @@ string
 handleWriteError(const char *text,
                  FastOS_FileInterface &file,
                  int64_t lastKnownGoodPos,
-                 const Packet::Entry &entry,
+                 SerialNum lastSerial,
                  int bufLen)
 {
     string last(FastOS_File::getLastErrorString());
-    string e(make_string("%s. File '%s' at position %" PRId64 " for entry %" PRIu64 " of length %u. "
+    string e(make_string("%s. File '%s' at position %" PRId64 " for entries up to %" PRIu64 " of length %u. "
                          "OS says '%s'. Rewind to last known good position %" PRId64 ".",
-                         text, file.GetFileName(), file.GetPosition(), entry.serial(), bufLen,
+                         text, file.GetFileName(), file.GetPosition(), lastSerial, bufLen,
                          last.c_str(), lastKnownGoodPos));
     LOG(error, "%s",  e.c_str());
     if ( ! file.SetPosition(lastKnownGoodPos) ) {
@@ -272,12 +273,10 @@ DomainPart::buildPacketMapping(bool allowTruncate)
 DomainPart::DomainPart(const string & name,
                        const string & baseDir,
                        SerialNum s,
-                       bool useFsync,
                        Crc defaultCrc,
                        const FileHeaderContext &fileHeaderContext,
                        bool allowTruncate) :
     _defaultCrc(defaultCrc),
-    _useFsync(useFsync),
     _lock(),
     _fileLock(),
     _range(s),
@@ -412,24 +411,25 @@ DomainPart::commit(SerialNum firstSerial, const Packet &packet)
     if (_range.from() == 0) {
         _range.from(firstSerial);
     }
-    for (size_t i(0); h.size() > 0; i++) {
-        //LOG(spam,
-        //"Pos(%d) Len(%d), Lim(%d), Remaining(%d)",
-        //h.getPos(), h.getLength(), h.getLimit(), h.getRemaining());
+    // All entries in the packet are written with a single write.
+    nbostream os;
+    SerialNum lastSerial(_range.to());
+    size_t numEntries(0);
+    while (h.size() > 0) {
         Packet::Entry entry;
         entry.deserialize(h);
-        if (_range.to() < entry.serial()) {
-            write(_transLog, entry);
-            _sz++;
-            _range.to(entry.serial());
+        if (lastSerial < entry.serial()) {
+            serialize(os, entry);
+            lastSerial = entry.serial();
+            numEntries++;
         } else {
             throw runtime_error(make_string("Incomming serial number(%ld) must be bigger than the last one (%ld).",
-                                            entry.serial(), _range.to()));
+                                            entry.serial(), lastSerial));
         }
     }
-    if (_useFsync) {
-        sync();
-    }
+    write(_transLog, lastSerial, os);
+    _sz += numEntries;
+    _range.to(lastSerial);
 
     bool merged(false);
     LockGuard guard(_lock);
@@ -449,6 +449,23 @@ DomainPart::commit(SerialNum firstSerial, const Packet &packet)
     }
 }
 
+void
+DomainPart::preallocate(uint64_t sz)
+{
+    LockGuard guard(_fileLock);
+    if ( ! _transLog.IsOpened()) {
+        return;
+    }
+    int64_t end(_transLog.GetSize());
+    if (end >= int64_t(sz)) {
+        return;
+    }
+    if (fallocate(_transLog.getFileDescriptor(), FALLOC_FL_KEEP_SIZE, end, sz - end) != 0) {
+        LOG(debug, "Failed preallocating %" PRIu64 " bytes for file '%s': %s",
+                   sz, _transLog.GetFileName(), FastOS_File::getLastErrorString().c_str());
+    }
+}
+
 void DomainPart::sync()
 {
     SerialNum syncSerial(0);
@@ -582,12 +599,11 @@ DomainPart::visit(FastOS_FileInterface &file, SerialNumRange &r, Packet &packet)
 }
 
 void
-DomainPart::write(FastOS_FileInterface &file, const Packet::Entry &entry)
+DomainPart::serialize(nbostream &os, const Packet::Entry &entry) const
 {
-    int64_t lastKnownGoodPos(file.GetPosition());
     int32_t crc(0);
     uint32_t len(entry.serializedSize() + sizeof(crc));
-    nbostream os;
+    size_t begin(os.size());
     os << static_cast<uint8_t>(_defaultCrc);
     os << len;
     size_t start(os.size());
@@ -595,14 +611,21 @@ DomainPart::write(FastOS_FileInterface &file, const Packet::Entry &entry)
     size_t end(os.size());
     crc = calcCrc(_defaultCrc, os.c_str()+start, end - start);
     os << crc;
+    assert(os.size() - begin == len + sizeof(len) + sizeof(uint8_t));
+    (void) begin;
+}
+
+void
+DomainPart::write(FastOS_FileInterface &file, SerialNum lastSerial, const nbostream &os)
+{
+    int64_t lastKnownGoodPos(file.GetPosition());
     size_t osSize = os.size();
-    assert(osSize == len + sizeof(len) + sizeof(uint8_t));
 
     LockGuard guard(_writeLock);
     if ( ! file.CheckedWrite(os.c_str(), osSize) ) {
-        throw runtime_error(handleWriteError("Failed writing the entry.", file, lastKnownGoodPos, entry, end - start));
+        throw runtime_error(handleWriteError("Failed writing the entries.", file, lastKnownGoodPos, lastSerial, osSize));
     }
-    _writtenSerial = entry.serial();
+    _writtenSerial = lastSerial;
     _byteSize.store(lastKnownGoodPos + osSize, std::memory_order_release);
 }
 
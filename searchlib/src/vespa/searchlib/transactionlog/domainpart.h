@@ -29,7 +29,6 @@ public:
     DomainPart(const vespalib::string &name,
                const vespalib::string &baseDir,
                SerialNum s,
-               bool useFsync,
                Crc defaultCrc,
                const common::FileHeaderContext &FileHeaderContext,
                bool allowTruncate);
@@ -43,6 +42,11 @@ public:
     bool visit(FastOS_FileInterface &file, SerialNumRange &r, Packet &packet);
     bool close();
     void sync();
+    /**
+     * Reserve disk space for the file up to the given size without changing its size,
+     * to avoid allocating blocks on each write and the extra metadata updates when syncing.
+     */
+    void preallocate(uint64_t sz);
     SerialNumRange range() const { return _range; }
 
     SerialNum getSynced() const {
@@ -65,7 +69,8 @@ private:
          vespalib::alloc::Alloc &buf,
          bool allowTruncate);
 
-    void write(FastOS_FileInterface &file, const Packet::Entry &entry);
+    void serialize(vespalib::nbostream &os, const Packet::Entry &entry) const;
+    void write(FastOS_FileInterface &file, SerialNum lastSerial, const vespalib::nbostream &os);
     static int32_t calcCrc(Crc crc, const void * buf, size_t len);
     void writeHeader(const common::FileHeaderContext &fileHeaderContext);
 
@@ -93,7 +98,6 @@ private:
     typedef std::vector<SkipInfo> SkipList;
     typedef std::map<SerialNum, Packet> PacketList;
     const Crc      _defaultCrc;
-    const bool     _useFsync;
     vespalib::Lock _lock;
     vespalib::Lock _fileLock;
     SerialNumRange _range;
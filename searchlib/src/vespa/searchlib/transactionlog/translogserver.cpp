@@ -184,6 +184,7 @@ void TransLogServer::run()
             } else if (strcmp(req->GetMethodName(), "domainStatus") == 0) {
                 domainStatus(req);
             } else if (strcmp(req->GetMethodName(), "domainCommit") == 0) {
+                immediate = false;
                 domainCommit(req);
             } else if (strcmp(req->GetMethodName(), "domainPrune") == 0) {
                 domainPrune(req);
@@ -491,17 +492,24 @@ void TransLogServer::domainCommit(FRT_RPCRequest *req)
     Domain::SP domain(findDomain(domainName));
     if (domain) {
         Packet packet(params[1]._data._buf, params[1]._data._len);
-        try {
-            domain->commit(packet);
-            ret.AddInt32(0);
-            ret.AddString("ok");
-        } catch (const std::exception & e) {
-            ret.AddInt32(-2);
-            ret.AddString(make_string("Exception during commit on %s : %s", domainName, e.what()).c_str());
-        }
+        // The reply is sent when the packet has been written and synced together with
+        // other commits, so the rpc thread does not wait for it.
+        vespalib::string name(domainName);
+        domain->commit(packet, [req, name](const vespalib::string & error) {
+            FRT_Values & rvals = *req->GetReturn();
+            if (error.empty()) {
+                rvals.AddInt32(0);
+                rvals.AddString("ok");
+            } else {
+                rvals.AddInt32(-2);
+                rvals.AddString(make_string("Exception during commit on %s : %s", name.c_str(), error.c_str()).c_str());
+            }
+            req->Return();
+        });
     } else {
         ret.AddInt32(-1);
         ret.AddString(make_string("Could not find domain %s", domainName).c_str());
+        req->Return();
     }
 }
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "docsumstorevalue.h"
+#include <vector>
 
 namespace search {
 namespace docsummary {
@@ -42,6 +43,14 @@ public:
      **/
     virtual DocsumStoreValue getMappedDocsum(uint32_t docid) = 0;
 
+    /**
+     * Hint that the docsums for the given documents will be fetched
+     * soon. Default is to do nothing.
+     *
+     * @param docids local document ids
+     **/
+    virtual void prefetch(const std::vector<uint32_t> &docids) { (void) docids; }
+
     /**
      * Will return default input class used.
      **/
@@ -41,6 +41,8 @@ private:
     void testCacheEntriesHonoured();
     void testCacheMaxSizeHonoured();
     void testThatMultipleRemoveOnOverflowIsFine();
+    void testThatProbationSegmentProtectsFrequentlyUsed();
+    void testThatInvalidateRemovesFromProbation();
 };
 
 int
@@ -53,6 +55,8 @@ Test::Main()
     testCacheEntriesHonoured();
     testCacheMaxSizeHonoured();
     testThatMultipleRemoveOnOverflowIsFine();
+    testThatProbationSegmentProtectsFrequentlyUsed();
+    testThatInvalidateRemovesFromProbation();
     TEST_DONE();
 }
 
@@ -159,5 +163,56 @@ void Test::testThatMultipleRemoveOnOverflowIsFine()
     EXPECT_EQUAL(2924u, cache.sizeBytes());
 }
 
+void Test::testThatProbationSegmentProtectsFrequentlyUsed()
+{
+    B m;
+    for (uint32_t i(0); i < 100; i++) {
+        m[i] = "a";
+    }
+    cache< CacheParam<P, B, zero<uint32_t>, size<string> > > cache(m, 1000);
+    cache.maxProbationBytes(300);
+    EXPECT_EQUAL(300u, cache.probationCapacityBytes());
+    EXPECT_EQUAL("a", cache.read(0));
+    EXPECT_EQUAL(1u, cache.size());
+    EXPECT_EQUAL(0u, cache.getPromoted());
+    EXPECT_EQUAL("a", cache.read(0));
+    EXPECT_EQUAL(1u, cache.getPromoted());
+    EXPECT_EQUAL(1u, cache.size());
+    EXPECT_EQUAL(81u, cache.sizeBytes());
+    for (uint32_t i(1); i < 100; i++) {
+        EXPECT_EQUAL("a", cache.read(i));
+    }
+    EXPECT_TRUE( cache.hasKey(0) );
+    EXPECT_FALSE( cache.hasKey(1) );
+    EXPECT_FALSE( cache.hasKey(95) );
+    EXPECT_TRUE( cache.hasKey(96) );
+    EXPECT_TRUE( cache.hasKey(99) );
+    EXPECT_EQUAL(5u, cache.size());
+    EXPECT_EQUAL(405u, cache.sizeBytes());
+    EXPECT_EQUAL(95u, cache.getEvicted());
+    EXPECT_EQUAL(1u, cache.getHit());
+    EXPECT_EQUAL(100u, cache.getMiss());
+}
+
+void Test::testThatInvalidateRemovesFromProbation()
+{
+    B m;
+    m[1] = "a";
+    m[2] = "b";
+    cache< CacheParam<P, B, zero<uint32_t>, size<string> > > cache(m, 1000);
+    cache.maxProbationBytes(300);
+    cache.read(1);
+    cache.read(2);
+    cache.read(2);
+    EXPECT_EQUAL(2u, cache.size());
+    cache.invalidate(1);
+    EXPECT_FALSE( cache.hasKey(1) );
+    EXPECT_TRUE( cache.hasKey(2) );
+    cache.invalidate(2);
+    EXPECT_FALSE( cache.hasKey(2) );
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQUAL(0u, cache.sizeBytes());
+    EXPECT_EQUAL(2u, cache.getInvalidate());
+}
 
 TEST_APPHOOK(Test)
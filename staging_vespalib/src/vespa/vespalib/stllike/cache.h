@@ -38,6 +38,11 @@ struct CacheParam : public P
  * Stuff is evicted from the cache if either number of elements or the accounted size passes the limits given.
  * The cache is thread safe by a single lock for accessing the underlying Lru. In addition a striped locking with
  * 64 locks chosen by the hash of the key to enable a single fetch for any element required by multiple readers.
+ *
+ * The cache can optionally be segmented by giving it a probation size. Objects fetched from the backing store
+ * are then first put in a separate probation LRU of that size, and only admitted to the main LRU when they are
+ * accessed a second time. A scan reading lots of objects once will then only evict from the probation segment,
+ * and leave the frequently used objects in the main segment alone.
  */
 template< typename P >
 class cache : private lrucache_map<P>
@@ -70,12 +75,20 @@ public:
      * Can be used for reserving space for elements.
      */
     cache & reserveElements(size_t elems);
+    /**
+     * Can be used for enabling the probation segment. The given number of bytes is
+     * taken from the total capacity. 0, which is the default, disables it.
+     * It must be less than the total capacity, as nothing promoted from the
+     * probation segment could otherwise be kept.
+     */
+    cache & maxProbationBytes(size_t maxBytes);
 
     size_t capacity()                  const { return Lru::capacity(); }
     size_t capacityBytes()             const { return _maxBytes; }
-    size_t size()                      const { return Lru::size(); }
-    size_t sizeBytes()                 const { return _sizeBytes; }
-    bool empty()                       const { return Lru::empty(); }
+    size_t probationCapacityBytes()    const { return _maxProbationBytes; }
+    size_t size()                      const { return Lru::size() + _probation.size(); }
+    size_t sizeBytes()                 const { return _sizeBytes + _probationSizeBytes; }
+    bool empty()                       const { return Lru::empty() && _probation.empty(); }
 
     /**
      * This simply erases the object.
@@ -116,6 +129,8 @@ public:
     size_t        getErase() const { return _erase; }
     size_t   getInvalidate() const { return _invalidate; }
     size_t       getlookup() const { return _lookup; }
+    size_t      getEvicted() const { return _evicted; }
+    size_t     getPromoted() const { return _promoted; }
 
 protected:
     vespalib::LockGuard getGuard();
@@ -123,6 +138,22 @@ protected:
     bool hasKey(const vespalib::LockGuard & guard, const K & key) const;
     bool hasLock() const;
 private:
+    /**
+     * The probation segment. Evicts on its own byte limit only.
+     */
+    class ProbationLru : public lrucache_map<P>
+    {
+    public:
+        ProbationLru(cache & owner) : lrucache_map<P>(lrucache_map<P>::UNLIMITED), _owner(owner) { }
+        bool removeOldest(const value_type & v) override { return _owner.removeOldestProbation(v); }
+    private:
+        cache & _owner;
+    };
+
+    bool segmented() const { return _maxProbationBytes != 0; }
+    bool removeOldestProbation(const value_type & v);
+    V promote(const K & key);
+    bool invalidateProbation(const K & key);
     /**
      * Called when an object is inserted, to see if the LRU should be removed.
      * Default is to obey the maxsize given in constructor.
@@ -140,6 +171,8 @@ private:
     SizeV               _sizeV;
     size_t              _maxBytes;
     size_t              _sizeBytes;
+    size_t              _maxProbationBytes;
+    size_t              _probationSizeBytes;
     mutable size_t      _hit;
     mutable size_t      _miss;
     mutable size_t      _noneExisting;
@@ -149,7 +182,10 @@ private:
     mutable size_t      _erase;
     mutable size_t      _invalidate;
     mutable size_t      _lookup;
+    size_t              _evicted;
+    size_t              _promoted;
     BackingStore      & _store;
+    ProbationLru        _probation;
     vespalib::Lock      _hashLock;
     /// Striped locks that can be used for having a locked access to the backing store.
     vespalib::Lock      _addLocks[113];
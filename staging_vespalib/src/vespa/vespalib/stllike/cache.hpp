@@ -3,6 +3,8 @@
 
 #include "cache.h"
 #include "lrucache_map.hpp"
+#include <algorithm>
+#include <cassert>
 
 namespace vespalib {
 
@@ -20,6 +22,16 @@ cache<P>::reserveElements(size_t elems) {
     return *this;
 }
 
+template< typename P >
+cache<P> &
+cache<P>::maxProbationBytes(size_t maxBytes) {
+    vespalib::LockGuard guard(_hashLock);
+    assert(_probation.empty());
+    assert((maxBytes == 0) || (maxBytes < _maxBytes));
+    _maxProbationBytes = maxBytes;
+    return *this;
+}
+
 template< typename P >
 void
 cache<P>::invalidate(const K & key) {
@@ -48,6 +60,8 @@ cache<P>::cache(BackingStore & b, size_t maxBytes) :
     Lru(Lru::UNLIMITED),
     _maxBytes(maxBytes),
     _sizeBytes(0),
+    _maxProbationBytes(0),
+    _probationSizeBytes(0),
     _hit(0),
     _miss(0),
     _noneExisting(0),
@@ -57,19 +71,48 @@ cache<P>::cache(BackingStore & b, size_t maxBytes) :
     _erase(0),
     _invalidate(0),
     _lookup(0),
-    _store(b)
+    _evicted(0),
+    _promoted(0),
+    _store(b),
+    _probation(*this)
 { }
 
 template< typename P >
 bool
 cache<P>::removeOldest(const value_type & v) {
-    bool remove(Lru::removeOldest(v) || (sizeBytes() >= capacityBytes()));
+    bool remove(Lru::removeOldest(v) || (_sizeBytes >= (capacityBytes() - _maxProbationBytes)));
     if (remove) {
         _sizeBytes -= calcSize(v.first, v.second._value);
+        _evicted++;
     }
     return remove;
 }
 
+template< typename P >
+bool
+cache<P>::removeOldestProbation(const value_type & v) {
+    bool remove(_probationSizeBytes >= _maxProbationBytes);
+    if (remove) {
+        _probationSizeBytes -= calcSize(v.first, v.second._value);
+        _evicted++;
+    }
+    return remove;
+}
+
+template< typename P >
+typename P::Value
+cache<P>::promote(const K & key) {
+    V & probationValue = _probation[key];
+    size_t sz = calcSize(key, probationValue);
+    V value(std::move(probationValue));
+    _probation.erase(key);
+    _probationSizeBytes -= sz;
+    Lru::insert(key, value);
+    _sizeBytes += sz;
+    _promoted++;
+    return value;
+}
+
 template< typename P >
 vespalib::LockGuard
 cache<P>::getGuard() {
@@ -85,6 +128,9 @@ cache<P>::read(const K & key)
         if (Lru::hasKey(key)) {
             _hit++;
             return (*this)[key];
+        } else if (_probation.hasKey(key)) {
+            _hit++;
+            return promote(key);
         } else {
             _miss++;
         }
@@ -97,13 +143,21 @@ cache<P>::read(const K & key)
             // Somebody else just fetched it ahead of me.
             _race++;
             return (*this)[key];
+        } else if (_probation.hasKey(key)) {
+            _race++;
+            return promote(key);
         }
     }
     V value;
     if (_store.read(key, value)) {
         vespalib::LockGuard guard(_hashLock);
-        Lru::insert(key, value);
-        _sizeBytes += calcSize(key, value);
+        if (segmented()) {
+            _probation.insert(key, value);
+            _probationSizeBytes += calcSize(key, value);
+        } else {
+            Lru::insert(key, value);
+            _sizeBytes += calcSize(key, value);
+        }
         _insert++;
     } else {
         vespalib::Atomic::postInc(&_noneExisting);
@@ -118,6 +172,7 @@ cache<P>::write(const K & key, const V & value)
     vespalib::LockGuard storeGuard(getLock(key));
     {
         vespalib::LockGuard guard(_hashLock);
+        invalidateProbation(key);
         (*this)[key] = value;
         _sizeBytes += calcSize(key, value);
         _write++;
@@ -144,7 +199,21 @@ cache<P>::invalidate(const vespalib::LockGuard & guard, const K & key)
         _sizeBytes -= calcSize(key, (*this)[key]);
         _invalidate++;
         Lru::erase(key);
+    } else if (invalidateProbation(key)) {
+        _invalidate++;
+    }
+}
+
+template< typename P >
+bool
+cache<P>::invalidateProbation(const K & key)
+{
+    if (!_probation.hasKey(key)) {
+        return false;
     }
+    _probationSizeBytes -= calcSize(key, _probation.get(key));
+    _probation.erase(key);
+    return true;
 }
 
 template< typename P >
@@ -154,7 +223,7 @@ cache<P>::hasKey(const vespalib::LockGuard & guard, const K & key) const
     (void) guard;
     assert(guard.locks(_hashLock));
     _lookup++;
-    return Lru::hasKey(key);
+    return Lru::hasKey(key) || _probation.hasKey(key);
 }
 
 }
@@ -4,6 +4,10 @@
 #include <vespa/vespalib/util/alloc.h>
 #include <vespa/vespalib/util/exceptions.h>
 #include <cstddef>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
 
 using namespace vespalib;
 using namespace vespalib::alloc;
@@ -256,4 +260,33 @@ TEST("auto alloced mmap alloc can not be shrinked below HUGEPAGE_SIZE/2 + 1 ") {
     EXPECT_EQUAL(SZ, buf.size());
 }
 
+TEST("file mmap alloc is copy-on-write") {
+    const char *fileName = "mapped_file.dat";
+    std::vector<char> content(4096 + 100);
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = 'a' + (i % 26);
+    }
+    int fd = open(fileName, O_CREAT | O_TRUNC | O_RDWR, 0644);
+    ASSERT_TRUE(fd >= 0);
+    ASSERT_EQUAL(ssize_t(content.size()), write(fd, &content[0], content.size()));
+    {
+        Alloc buf = Alloc::allocMMapFile(fd, 4096, 100);
+        close(fd);
+        EXPECT_EQUAL(4096ul, buf.size());
+        char *data = static_cast<char *>(buf.get());
+        EXPECT_EQUAL(0, memcmp(data, &content[4096], 100));
+        data[0] = 'X';
+        EXPECT_EQUAL('X', data[0]);
+        Alloc other = buf.create(100);
+        EXPECT_EQUAL(4096ul, other.size());
+    }
+    fd = open(fileName, O_RDONLY);
+    ASSERT_TRUE(fd >= 0);
+    std::vector<char> after(content.size());
+    EXPECT_EQUAL(ssize_t(after.size()), read(fd, &after[0], after.size()));
+    close(fd);
+    EXPECT_TRUE(content == after);
+    unlink(fileName);
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
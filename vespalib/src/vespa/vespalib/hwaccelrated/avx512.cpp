@@ -2,11 +2,55 @@
 
 #include "avx512.h"
 #include "avxprivate.hpp"
+#include <immintrin.h>
 
 namespace vespalib {
 
 namespace hwaccelrated {
 
+namespace {
+
+#ifdef __AVX512BW__
+/**
+ * Counts 64 bytes per iteration. Uses vpopcntq when the compiler targets a cpu
+ * with AVX512-VPOPCNTDQ, otherwise the nibble lookup on 512 bit registers.
+ */
+template <typename Load, typename ScalarLoad>
+size_t
+populationCountAvx512(Load load, ScalarLoad scalarLoad, size_t sz)
+{
+    const size_t numVectors(sz/8);
+    __m512i acc = _mm512_setzero_si512();
+#ifdef __AVX512VPOPCNTDQ__
+    for (size_t i(0); i < numVectors; i++) {
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(load(i)));
+    }
+#else
+    const __m512i lookup = _mm512_set4_epi32(0x04030302, 0x03020201, 0x03020201, 0x02010100);
+    const __m512i lowMask = _mm512_set1_epi8(0x0f);
+    for (size_t i(0); i < numVectors; i++) {
+        const __m512i v = load(i);
+        const __m512i lo = _mm512_and_si512(v, lowMask);
+        const __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), lowMask);
+        const __m512i cnt = _mm512_add_epi8(_mm512_shuffle_epi8(lookup, lo), _mm512_shuffle_epi8(lookup, hi));
+        acc = _mm512_add_epi64(acc, _mm512_sad_epu8(cnt, _mm512_setzero_si512()));
+    }
+#endif
+    uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, acc);
+    size_t sum(0);
+    for (size_t i(0); i < 8; i++) {
+        sum += lanes[i];
+    }
+    for (size_t i(numVectors*8); i < sz; i++) {
+        sum += __builtin_popcountl(scalarLoad(i));
+    }
+    return sum;
+}
+#endif
+
+}
+
 float
 Avx512Accelrator::dotProduct(const float * af, const float * bf, size_t sz) const
 {
@@ -19,5 +63,35 @@ Avx512Accelrator::dotProduct(const double * af, const double * bf, size_t sz) co
     return avx::dotProductSelectAlignment<double, 64>(af, bf, sz);
 }
 
+size_t
+Avx512Accelrator::populationCount(const uint64_t * a, size_t sz) const
+{
+#ifdef __AVX512BW__
+    const __m512i * av = reinterpret_cast<const __m512i *>(a);
+    return populationCountAvx512([av](size_t i) { return _mm512_loadu_si512(av + i); },
+                                 [a](size_t i) { return a[i]; }, sz);
+#else
+    return Avx2Accelrator::populationCount(a, sz);
+#endif
+}
+
+void
+Avx512Accelrator::andWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const
+{
+    avx::multiWordOperation<uint64_t, 64>([](auto a, auto b) { return a & b; }, dest, src, numSrc, offset, sz);
+}
+
+void
+Avx512Accelrator::orWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const
+{
+    avx::multiWordOperation<uint64_t, 64>([](auto a, auto b) { return a | b; }, dest, src, numSrc, offset, sz);
+}
+
+size_t
+Avx512Accelrator::nextSetBit(const uint64_t * a, size_t start, size_t end) const
+{
+    return avx::nextSetBit<uint64_t, 64>(a, start, end);
+}
+
 }
 }
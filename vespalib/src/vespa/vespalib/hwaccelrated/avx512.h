@@ -16,6 +16,10 @@ class Avx512Accelrator : public Avx2Accelrator
 public:
     float dotProduct(const float * a, const float * b, size_t sz) const override;
     double dotProduct(const double * a, const double * b, size_t sz) const override;
+    size_t populationCount(const uint64_t * a, size_t sz) const override;
+    void andWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const override;
+    void orWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const override;
+    size_t nextSetBit(const uint64_t * a, size_t start, size_t end) const override;
 };
 
 }
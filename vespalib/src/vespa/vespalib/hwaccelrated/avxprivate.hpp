@@ -3,6 +3,8 @@
 #pragma once
 
 #include <vespa/fastos/dynamiclibrary.h>
+#include <algorithm>
+#include <cstring>
 
 namespace vespalib {
 
@@ -79,6 +81,78 @@ T dotProductSelectAlignment(const T * af, const T * bf, size_t sz)
     }
 }
 
+template <typename T, size_t VLEN, typename Operation>
+VESPA_DLL_LOCAL void multiWordOperation(Operation operation, T * dest, const T * const * src,
+                                        size_t numSrc, size_t offset, size_t sz);
+
+template <typename T, size_t VLEN, typename Operation>
+void multiWordOperation(Operation operation, T * dest, const T * const * src,
+                        size_t numSrc, size_t offset, size_t sz)
+{
+    typedef T V __attribute__ ((vector_size (VLEN), aligned(sizeof(T))));
+    constexpr size_t WordsPerVector = VLEN/sizeof(T);
+    constexpr size_t ChunkWords = 256;
+    for (size_t chunkStart(0); chunkStart < sz; chunkStart += ChunkWords) {
+        const size_t chunkSz(std::min(ChunkWords, sz - chunkStart));
+        const size_t numVectors(chunkSz/WordsPerVector);
+        T * d(dest + chunkStart);
+        V * dv = reinterpret_cast<V *>(d);
+        memcpy(d, src[0] + offset + chunkStart, chunkSz * sizeof(T));
+        for (size_t n(1); n < numSrc; n++) {
+            const T * s(src[n] + offset + chunkStart);
+            const V * sv = reinterpret_cast<const V *>(s);
+            for (size_t i(0); i < numVectors; i++) {
+                dv[i] = operation(dv[i], sv[i]);
+            }
+            for (size_t i(numVectors*WordsPerVector); i < chunkSz; i++) {
+                d[i] = operation(d[i], s[i]);
+            }
+        }
+    }
+}
+
+template <typename T, size_t VLEN, size_t VectorsPerChunk=4>
+VESPA_DLL_LOCAL size_t nextSetBit(const T * a, size_t start, size_t end);
+
+template <typename T, size_t VLEN, size_t VectorsPerChunk>
+size_t nextSetBit(const T * a, size_t start, size_t end)
+{
+    static_assert(sizeof(T) == sizeof(uint64_t), "Expects 64 bit words");
+    typedef T V __attribute__ ((vector_size (VLEN)));
+    typedef T U __attribute__ ((vector_size (VLEN), aligned(sizeof(T))));
+    constexpr size_t ChunkWords = VLEN*VectorsPerChunk/sizeof(T);
+    if (start >= end) {
+        return end;
+    }
+    size_t index(start >> 6);
+    const size_t lastIndex((end - 1) >> 6);
+    T t(a[index] & (~0ul << (start & 63)));
+    // Skip runs of zero words a full chunk at a time before locating the word.
+    while ((t == 0) && (index + ChunkWords <= lastIndex)) {
+        const U * v = reinterpret_cast<const U *>(a + index + 1);
+        V acc = v[0];
+        for (size_t j(1); j < VectorsPerChunk; j++) {
+            acc |= v[j];
+        }
+        T any(0);
+        for (size_t j(0); j < VLEN/sizeof(T); j++) {
+            any |= acc[j];
+        }
+        if (any == 0) {
+            index += ChunkWords;
+        } else {
+            break;
+        }
+    }
+    while ((t == 0) && (index < lastIndex)) {
+        t = a[++index];
+    }
+    if (t == 0) {
+        return end;
+    }
+    return std::min(end, (index << 6) + __builtin_ctzl(t));
+}
+
 }
 }
 }
@@ -1,6 +1,8 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "generic.h"
+#include <algorithm>
+#include <cstring>
 
 namespace vespalib {
 
@@ -58,6 +60,55 @@ bitOperation(Operation operation, void * aOrg, const void * bOrg, size_t bytes)
     }
 }
 
+template<size_t UNROLL, typename Operation>
+void
+multiWordOperation(Operation operation, uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz)
+{
+    // Work in chunks small enough for dest to stay in L1 while all sources are folded in.
+    constexpr size_t ChunkWords = 256;
+    for (size_t chunkStart(0); chunkStart < sz; chunkStart += ChunkWords) {
+        const size_t chunkSz(std::min(ChunkWords, sz - chunkStart));
+        uint64_t * d(dest + chunkStart);
+        memcpy(d, src[0] + offset + chunkStart, chunkSz * sizeof(uint64_t));
+        for (size_t n(1); n < numSrc; n++) {
+            const uint64_t * s(src[n] + offset + chunkStart);
+            size_t i(0);
+            for (; i + UNROLL <= chunkSz; i += UNROLL) {
+                for (size_t j(0); j < UNROLL; j++) {
+                    d[i + j] = operation(d[i + j], s[i + j]);
+                }
+            }
+            for (; i < chunkSz; i++) {
+                d[i] = operation(d[i], s[i]);
+            }
+        }
+    }
+}
+
+template<size_t UNROLL, typename Load>
+size_t
+populationCountT(Load load, size_t sz)
+{
+    size_t partial[UNROLL];
+    for (size_t i(0); i < UNROLL; i++) {
+        partial[i] = 0;
+    }
+    size_t i(0);
+    for (; i + UNROLL <= sz; i += UNROLL) {
+        for (size_t j(0); j < UNROLL; j++) {
+            partial[j] += __builtin_popcountl(load(i + j));
+        }
+    }
+    for (; i < sz; i++) {
+        partial[0] += __builtin_popcountl(load(i));
+    }
+    size_t sum(0);
+    for (size_t j(0); j < UNROLL; j++) {
+        sum += partial[j];
+    }
+    return sum;
+}
+
 }
 
 float
@@ -115,5 +166,41 @@ GenericAccelrator::notBit(void * aOrg, size_t bytes) const
     }
 }
 
+size_t
+GenericAccelrator::populationCount(const uint64_t * a, size_t sz) const
+{
+    return populationCountT<4>([a](size_t i) { return a[i]; }, sz);
+}
+
+void
+GenericAccelrator::andWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const
+{
+    multiWordOperation<8>([](uint64_t a, uint64_t b) { return a & b; }, dest, src, numSrc, offset, sz);
+}
+
+void
+GenericAccelrator::orWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const
+{
+    multiWordOperation<8>([](uint64_t a, uint64_t b) { return a | b; }, dest, src, numSrc, offset, sz);
+}
+
+size_t
+GenericAccelrator::nextSetBit(const uint64_t * a, size_t start, size_t end) const
+{
+    if (start >= end) {
+        return end;
+    }
+    size_t index(start >> 6);
+    const size_t lastIndex((end - 1) >> 6);
+    uint64_t t(a[index] & (~0ul << (start & 63)));
+    while ((t == 0) && (index < lastIndex)) {
+        t = a[++index];
+    }
+    if (t == 0) {
+        return end;
+    }
+    return std::min(end, (index << 6) + __builtin_ctzl(t));
+}
+
 }
 }
@@ -24,6 +24,10 @@ public:
     void andBit(void * a, const void * b, size_t bytes) const override;
     void andNotBit(void * a, const void * b, size_t bytes) const override;
     void notBit(void * a, size_t bytes) const override;
+    size_t populationCount(const uint64_t * a, size_t sz) const override;
+    void andWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const override;
+    void orWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const override;
+    size_t nextSetBit(const uint64_t * a, size_t start, size_t end) const override;
 };
 
 }
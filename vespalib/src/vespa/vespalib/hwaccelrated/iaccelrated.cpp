@@ -6,6 +6,7 @@
 #include <vespa/vespalib/hwaccelrated/avx.h>
 #include <vespa/vespalib/hwaccelrated/avx2.h>
 #include <vespa/vespalib/hwaccelrated/avx512.h>
+#include <cstring>
 
 namespace vespalib {
 
@@ -66,6 +67,47 @@ void verifyAccelrator(const IAccelrated & accel)
     delete [] b;
 }
 
+void verifyBitAccelrator(const IAccelrated & accel)
+{
+    GenericAccelrator generic;
+    const size_t testLength(133);
+    uint64_t a[testLength];
+    uint64_t b[testLength];
+    uint64_t c[testLength];
+    for (size_t i(0); i < testLength; i++) {
+        a[i] = 0x9e3779b97f4a7c15ul * (i + 1);
+        b[i] = (i % 7 == 0) ? 0ul : ~(a[i] >> (i % 5));
+        c[i] = 0;
+    }
+    const uint64_t * src[2] = { a, b };
+    uint64_t expected[testLength];
+    uint64_t actual[testLength];
+    for (size_t j(0); j < 0x20; j++) {
+        const size_t sz(testLength - j);
+        if (generic.populationCount(a + j, sz) != accel.populationCount(a + j, sz)) {
+            fprintf(stderr, "Accelrator is not computing population count correctly.\n");
+            abort();
+        }
+        generic.andWords(expected, src, 2, j, sz);
+        accel.andWords(actual, src, 2, j, sz);
+        if (memcmp(expected, actual, sz * sizeof(uint64_t)) != 0) {
+            fprintf(stderr, "Accelrator is not computing multiway and correctly.\n");
+            abort();
+        }
+        generic.orWords(expected, src, 2, j, sz);
+        accel.orWords(actual, src, 2, j, sz);
+        if (memcmp(expected, actual, sz * sizeof(uint64_t)) != 0) {
+            fprintf(stderr, "Accelrator is not computing multiway or correctly.\n");
+            abort();
+        }
+        c[testLength - 1 - j] = 1ul << j;
+        if (generic.nextSetBit(c, j * 3, testLength * 64) != accel.nextSetBit(c, j * 3, testLength * 64)) {
+            fprintf(stderr, "Accelrator is not finding next set bit correctly.\n");
+            abort();
+        }
+    }
+}
+
 class RuntimeVerificator
 {
 public:
@@ -85,7 +127,8 @@ RuntimeVerificator::RuntimeVerificator()
    verifyAccelrator<double>(*thisCpu); 
    verifyAccelrator<int32_t>(*thisCpu); 
    verifyAccelrator<int64_t>(*thisCpu); 
-   
+   verifyBitAccelrator(*thisCpu);
+
 }
 
 class Selector
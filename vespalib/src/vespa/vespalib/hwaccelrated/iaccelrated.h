@@ -26,6 +26,14 @@ public:
     virtual void andBit(void * a, const void * b, size_t bytes) const = 0;
     virtual void andNotBit(void * a, const void * b, size_t bytes) const = 0;
     virtual void notBit(void * a, size_t bytes) const = 0;
+    // Number of set bits in the sz words starting at a.
+    virtual size_t populationCount(const uint64_t * a, size_t sz) const = 0;
+    // dest[i] = src[0][offset+i] & ... & src[numSrc-1][offset+i] for i in [0, sz>. numSrc must be >= 1.
+    virtual void andWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const = 0;
+    // dest[i] = src[0][offset+i] | ... | src[numSrc-1][offset+i] for i in [0, sz>. numSrc must be >= 1.
+    virtual void orWords(uint64_t * dest, const uint64_t * const * src, size_t numSrc, size_t offset, size_t sz) const = 0;
+    // Index of the first set bit in the bit range [start, end> of a, or end if there is none.
+    virtual size_t nextSetBit(const uint64_t * a, size_t start, size_t end) const = 0;
 
     static IAccelrated::UP getAccelrator() __attribute__((noinline));
 };
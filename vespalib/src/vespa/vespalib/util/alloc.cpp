@@ -144,6 +144,7 @@ public:
     size_t resize_inplace(PtrAndSize current, size_t newSize) const override;
     static size_t sresize_inplace(PtrAndSize current, size_t newSize);
     static PtrAndSize salloc(size_t sz, void * wantedAddress);
+    static PtrAndSize smapfile(int fd, size_t offset, size_t sz);
     static void sfree(PtrAndSize alloc);
     static MemoryAllocator & getDefault();
 private:
@@ -340,6 +341,33 @@ MMapAllocator::salloc(size_t sz, void * wantedAddress)
     return PtrAndSize(buf, sz);
 }
 
+MemoryAllocator::PtrAndSize
+MMapAllocator::smapfile(int fd, size_t offset, size_t sz)
+{
+    assert((offset % _G_pageSize) == 0);
+    void * buf(nullptr);
+    sz = roundUp2PageSize(sz);
+    if (sz > 0) {
+        size_t mmapId = std::atomic_fetch_add(&_G_mmapCount, 1ul);
+        string stackTrace;
+        if (sz >= _G_MMapLogLimit) {
+            stackTrace = getStackTrace(1);
+            LOG(info, "mmap %ld of size %ld from fd %d from %s", mmapId, sz, fd, stackTrace.c_str());
+        }
+        buf = mmap(nullptr, sz, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, offset);
+        if (buf == MAP_FAILED) {
+            throw IllegalStateException(make_string("Failed mmaping fd %d at offset %ld of size %ld errno(%d)",
+                                                    fd, offset, sz, errno));
+        }
+        if (sz >= _G_MMapLogLimit) {
+            LockGuard guard(_G_lock);
+            _G_HugeMappings[buf] = MMapInfo(mmapId, sz, stackTrace);
+            LOG(info, "%ld mappings of accumulated size %ld", _G_HugeMappings.size(), sum(_G_HugeMappings));
+        }
+    }
+    return PtrAndSize(buf, sz);
+}
+
 size_t
 MMapAllocator::sresize_inplace(PtrAndSize current, size_t newSize) {
     newSize = roundUp2PageSize(newSize);
@@ -464,6 +492,12 @@ Alloc::allocMMap(size_t sz)
     return Alloc(&MMapAllocator::getDefault(), sz);
 }
 
+Alloc
+Alloc::allocMMapFile(int fd, size_t offset, size_t sz)
+{
+    return Alloc(&MMapAllocator::getDefault(), MMapAllocator::smapfile(fd, offset, sz));
+}
+
 Alloc
 Alloc::alloc(size_t sz, size_t mmapLimit, size_t alignment)
 {
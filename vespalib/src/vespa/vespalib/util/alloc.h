@@ -98,6 +98,15 @@ public:
     static Alloc allocAlignedHeap(size_t sz, size_t alignment);
     static Alloc allocHeap(size_t sz=0);
     static Alloc allocMMap(size_t sz=0);
+    /**
+     * Map sz bytes of the open file fd, starting at the page aligned
+     * offset, copy-on-write. Pages are shared with the page cache until
+     * they are first written, at which point the kernel makes a
+     * private copy. Changes are never written back to the file.
+     * Extending the allocation or creating new allocations from it
+     * will use anonymous memory.
+     **/
+    static Alloc allocMMapFile(int fd, size_t offset, size_t sz);
     /**
      * Optional alignment is assumed to be <= system page size, since mmap
      * is always used when size is above limit.
@@ -105,6 +114,7 @@ public:
     static Alloc alloc(size_t sz=0, size_t mmapLimit = MemoryAllocator::HUGEPAGE_SIZE, size_t alignment=0);
 private:
     Alloc(const MemoryAllocator * allocator, size_t sz) : _alloc(allocator->alloc(sz)), _allocator(allocator) { }
+    Alloc(const MemoryAllocator * allocator, PtrAndSize alloc) : _alloc(alloc), _allocator(allocator) { }
     void clear() {
         _alloc.first = nullptr;
         _alloc.second = 0;